@@ -0,0 +1,102 @@
+#!/bin/sh
+# Compares solver profiles on the benchmarks. Every benchmark is
+# compiled with selfie and run by phantom once per profile. The
+# wall-clock time of each run in milliseconds, its peak resident set
+# size in megabytes and the total time of every profile are printed,
+# runs which exhaust the budget are marked by *. Options such as
+# -assumptions are passed on to every run, runs which reject them
+# are marked by n/a.
+#
+# usage: ./bench.sh [ -solver name ] [ -profiles "p ..." ] [ -budget s ] [ -options "o ..." ] selfie benchmarks
+
+solver=""
+profiles="default qfbv light"
+budget=60
+options=""
+
+while [ $# -gt 2 ]; do
+  case "$1" in
+    -solver)   solver="-solver $2"; shift 2 ;;
+    -profiles) profiles="$2"; shift 2 ;;
+    -budget)   budget="$2"; shift 2 ;;
+    -options)  options="$2"; shift 2 ;;
+    *)         break ;;
+  esac
+done
+
+if [ $# -ne 2 ]; then
+  echo "usage: ./bench.sh [ -solver name ] [ -profiles \"p ...\" ] [ -budget s ] [ -options \"o ...\" ] selfie benchmarks"
+  exit 1
+fi
+
+selfie="$1"
+benchmarks="$2"
+binaries=$(mktemp -d)
+output="$binaries/output"
+
+now() {
+  date +%s%N
+}
+
+printf "%-24s" "benchmark"
+for profile in $profiles; do
+  printf "%16s" "$profile"
+  eval "total_$profile=0"
+  eval "rejected_$profile=0"
+done
+printf "\n"
+
+for source in "$benchmarks"/*.c; do
+  name=$(basename "$source" .c)
+
+  if ! "$selfie" -c "$source" -o "$binaries/$name.m" > /dev/null 2>&1; then
+    printf "%-24s%16s\n" "$name" "no binary"
+    continue
+  fi
+
+  printf "%-24s" "$name"
+
+  for profile in $profiles; do
+    start=$(now)
+    ./phantom $solver -profile "$profile" $options -time-budget "$budget" -l "$binaries/$name.m" -sase 0 > "$output" 2>&1
+    code=$?
+    time=$(( ($(now) - start) / 1000000 ))
+    rss=$(grep -o "memory: [0-9]*MB" "$output" | cut -d " " -f 2)
+
+    if [ $code -eq 1 ]; then
+      printf "%16s" "n/a"
+      eval "rejected_$profile=1"
+      continue
+    elif [ $code -eq 15 ]; then
+      printf "%15s*" "$time/${rss:-?}"
+    else
+      printf "%16s" "$time/${rss:-?}"
+    fi
+
+    eval "total_$profile=\$(( total_$profile + time ))"
+  done
+
+  printf "\n"
+done
+
+fastest=""
+best=0
+
+printf "%-24s" "total"
+for profile in $profiles; do
+  eval "time=\$total_$profile"
+  eval "rejected=\$rejected_$profile"
+  printf "%16s" "$time"
+
+  if [ $rejected -eq 1 ]; then
+    continue
+  elif [ -z "$fastest" ] || [ "$time" -lt "$best" ]; then
+    fastest="$profile"
+    best="$time"
+  fi
+done
+printf "\n"
+
+echo "fastest profile: $fastest"
+
+rm -rf "$binaries"
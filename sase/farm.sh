@@ -0,0 +1,110 @@
+#!/bin/sh
+# Explores a binary with path prefixes farmed out to workers through
+# a shared directory. The binary is split into prefixes by phantom,
+# then every worker claims one prefix after the other by renaming it
+# and explores the subtree beneath it. Workers on other hosts which
+# share the directory join by running ./farm.sh -work with the same
+# arguments. Paths, bugs (exit code 12) and failed runs of all
+# prefixes finished so far are summed up at the end.
+#
+# usage: ./farm.sh [ -split n ] [ -workers n ] [ -work ] binary directory [ phantom options ]
+
+split=16
+workers=4
+work=0
+
+while [ $# -gt 2 ]; do
+  case "$1" in
+    -split)   split="$2"; shift 2 ;;
+    -workers) workers="$2"; shift 2 ;;
+    -work)    work=1; shift ;;
+    *)        break ;;
+  esac
+done
+
+if [ $# -lt 2 ]; then
+  echo "usage: ./farm.sh [ -split n ] [ -workers n ] [ -work ] binary directory [ phantom options ]"
+  exit 1
+fi
+
+binary="$1"
+directory="$2"
+shift 2
+options="$*"
+
+# claimed prefixes are renamed to prefix_N.host.pid, mv is atomic
+# within a file system so that no two workers explore the same prefix
+claim_and_explore() {
+  for prefix in "$directory"/prefix_*; do
+    case "$(basename "$prefix")" in
+      *.*) continue ;;
+    esac
+
+    claimed="$prefix.$(hostname).$$"
+
+    if mv "$prefix" "$claimed" 2> /dev/null; then
+      ./phantom $options -prefix "$claimed" -l "$binary" -sase 0 > "$claimed.out" 2>&1
+      echo $? > "$claimed.code"
+    fi
+  done
+}
+
+paths() {
+  n=$(grep -ho "backtracking: [0-9]*" "$1" | tail -n 1 | cut -d " " -f 2)
+  echo "${n:-0}"
+}
+
+if [ $work -eq 1 ]; then
+  claim_and_explore
+  exit 0
+fi
+
+mkdir -p "$directory"
+
+./phantom $options -split "$split" "$directory" -l "$binary" -sase 0 > "$directory/split.out" 2>&1
+code=$?
+
+if [ $code -eq 12 ]; then
+  echo "farm: bug found while splitting, see $directory/split.out"
+  exit 12
+elif [ $code -ne 0 ]; then
+  echo "farm: splitting failed with exit code $code, see $directory/split.out"
+  exit $code
+fi
+
+i=0
+while [ $i -lt $workers ]; do
+  claim_and_explore &
+  i=$(( i + 1 ))
+done
+
+wait
+
+prefixes=0
+total=$(paths "$directory/split.out")
+bugs=0
+failed=0
+
+for code_file in "$directory"/prefix_*.code; do
+  [ -f "$code_file" ] || continue
+
+  prefixes=$(( prefixes + 1 ))
+  code=$(cat "$code_file")
+  out="${code_file%.code}.out"
+
+  total=$(( total + $(paths "$out") ))
+
+  if [ "$code" -eq 12 ]; then
+    bugs=$(( bugs + 1 ))
+  elif [ "$code" -ne 0 ]; then
+    failed=$(( failed + 1 ))
+  fi
+done
+
+echo "farm: $prefixes prefixes, $total paths, $bugs bugs, $failed failed"
+
+if [ $bugs -gt 0 ]; then
+  exit 12
+elif [ $failed -gt 0 ]; then
+  exit 1
+fi
@@ -4,8 +4,14 @@
   and LICENSE conditions see the following website:
   http://selfie.cs.uni-salzburg.at
 
-  Furthermore this project uses the api of z3 SMT solver
-  further information: github.com/Z3Prover/z3
+  Furthermore this project uses the api of the SMT solvers
+  z3, cvc4, and boolector through the solver interface
+
+  All mutable global state of phantom, the engine and the solver
+  interface is thread_local, constants such as opcodes and exit codes
+  are plain globals. Several explorers, each a command line of its
+  own, run on threads of one process, see main, and share nothing
+  but constants, the backend tables and the number of explorers.
 */
 
 #include "sase.h"
@@ -109,19 +115,19 @@ uint64_t CPUBITWIDTH = 64;
 uint64_t SIZEOFUINT64     = 8; // must be the same as REGISTERSIZE
 uint64_t SIZEOFUINT64STAR = 8; // must be the same as REGISTERSIZE
 
-uint64_t* power_of_two_table;
+thread_local uint64_t* power_of_two_table;
 
-uint64_t INT64_MAX_T; // maximum numerical value of a signed 64-bit integer
-uint64_t INT64_MIN_T; // minimum numerical value of a signed 64-bit integer
+thread_local uint64_t INT64_MAX_T; // maximum numerical value of a signed 64-bit integer
+thread_local uint64_t INT64_MIN_T; // minimum numerical value of a signed 64-bit integer
 
-uint64_t UINT64_MAX_T; // maximum numerical value of an unsigned 64-bit integer
+thread_local uint64_t UINT64_MAX_T; // maximum numerical value of an unsigned 64-bit integer
 
 uint64_t MAX_FILENAME_LENGTH = 128;
 
-uint64_t* character_buffer; // buffer for reading and writing characters
-uint64_t* integer_buffer;   // buffer for printing integers
-uint64_t* filename_buffer;  // buffer for opening files
-uint64_t* binary_buffer;    // buffer for binary I/O
+thread_local uint64_t* character_buffer; // buffer for reading and writing characters
+thread_local uint64_t* integer_buffer;   // buffer for printing integers
+thread_local uint64_t* filename_buffer;  // buffer for opening files
+thread_local uint64_t* binary_buffer;    // buffer for binary I/O
 
 // flags for opening read-only files
 // LINUX:       0 = 0x0000 = O_RDONLY (0x0000)
@@ -148,10 +154,10 @@ uint64_t S_IRUSR_IWUSR_IRGRP_IROTH = 420;
 
 // ------------------------ GLOBAL VARIABLES -----------------------
 
-uint64_t number_of_written_characters = 0;
+thread_local uint64_t number_of_written_characters = 0;
 
-uint64_t* output_name = (uint64_t*) 0;
-uint64_t  output_fd   = 1; // 1 is file descriptor of standard output
+thread_local uint64_t* output_name = (uint64_t*) 0;
+thread_local uint64_t  output_fd   = 1; // 1 is file descriptor of standard output
 
 // ------------------------- INITIALIZATION ------------------------
 
@@ -200,35 +206,35 @@ void reset_library() {
 
 // ------------------------ GLOBAL VARIABLES -----------------------
 
-uint64_t line_number = 1; // current line number for error reporting
+thread_local uint64_t line_number = 1; // current line number for error reporting
 
-uint64_t* identifier = (uint64_t*) 0; // stores scanned identifier as string
-uint64_t* integer    = (uint64_t*) 0; // stores scanned integer as string
-uint64_t* string     = (uint64_t*) 0; // stores scanned string
+thread_local uint64_t* identifier = (uint64_t*) 0; // stores scanned identifier as string
+thread_local uint64_t* integer    = (uint64_t*) 0; // stores scanned integer as string
+thread_local uint64_t* string     = (uint64_t*) 0; // stores scanned string
 
-uint64_t literal = 0; // stores numerical value of scanned integer or character
+thread_local uint64_t literal = 0; // stores numerical value of scanned integer or character
 
-uint64_t integer_is_signed = 0; // enforce INT64_MIN limit if '-' was scanned before
+thread_local uint64_t integer_is_signed = 0; // enforce INT64_MIN limit if '-' was scanned before
 
-uint64_t character; // most recently read character
+thread_local uint64_t character; // most recently read character
 
-uint64_t number_of_read_characters = 0;
+thread_local uint64_t number_of_read_characters = 0;
 
-uint64_t symbol; // most recently recognized symbol
+thread_local uint64_t symbol; // most recently recognized symbol
 
-uint64_t number_of_ignored_characters = 0;
-uint64_t number_of_comments           = 0;
-uint64_t number_of_scanned_symbols    = 0;
+thread_local uint64_t number_of_ignored_characters = 0;
+thread_local uint64_t number_of_comments           = 0;
+thread_local uint64_t number_of_scanned_symbols    = 0;
 
-uint64_t* source_name = (uint64_t*) 0; // name of source file
-uint64_t  source_fd   = 0;             // file descriptor of open source file
+thread_local uint64_t* source_name = (uint64_t*) 0; // name of source file
+thread_local uint64_t  source_fd   = 0;             // file descriptor of open source file
 
-uint64_t number_of_global_variables = 0;
-uint64_t number_of_procedures       = 0;
-uint64_t number_of_strings          = 0;
+thread_local uint64_t number_of_global_variables = 0;
+thread_local uint64_t number_of_procedures       = 0;
+thread_local uint64_t number_of_strings          = 0;
 
-uint64_t number_of_searches = 0;
-uint64_t total_search_time  = 0;
+thread_local uint64_t number_of_searches = 0;
+thread_local uint64_t total_search_time  = 0;
 
 // *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~
 // -----------------------------------------------------------------
@@ -283,7 +289,7 @@ uint64_t REG_T4  = 29;
 uint64_t REG_T5  = 30;
 uint64_t REG_T6  = 31;
 
-uint64_t* REGISTERS; // strings representing registers
+thread_local uint64_t* REGISTERS; // strings representing registers
 
 // ------------------------- INITIALIZATION ------------------------
 
@@ -400,13 +406,13 @@ uint64_t F12_ECALL = 0; // 000000000000
 
 // ------------------------ GLOBAL VARIABLES -----------------------
 
-uint64_t opcode = 0;
-uint64_t rs1    = 0;
-uint64_t rs2    = 0;
-uint64_t rd     = 0;
-uint64_t imm    = 0;
-uint64_t funct3 = 0;
-uint64_t funct7 = 0;
+thread_local uint64_t opcode = 0;
+thread_local uint64_t rs1    = 0;
+thread_local uint64_t rs2    = 0;
+thread_local uint64_t rd     = 0;
+thread_local uint64_t imm    = 0;
+thread_local uint64_t funct3 = 0;
+thread_local uint64_t funct7 = 0;
 
 // -----------------------------------------------------------------
 // ---------------------------- BINARY -----------------------------
@@ -450,35 +456,35 @@ uint64_t ELF_ENTRY_POINT = 65536; // = 0x10000 (address of beginning of code)
 
 // instruction counters
 
-uint64_t ic_lui   = 0;
-uint64_t ic_addi  = 0;
-uint64_t ic_add   = 0;
-uint64_t ic_sub   = 0;
-uint64_t ic_mul   = 0;
-uint64_t ic_divu  = 0;
-uint64_t ic_remu  = 0;
-uint64_t ic_sltu  = 0;
-uint64_t ic_ld    = 0;
-uint64_t ic_sd    = 0;
-uint64_t ic_beq   = 0;
-uint64_t ic_jal   = 0;
-uint64_t ic_jalr  = 0;
-uint64_t ic_ecall = 0;
+thread_local uint64_t ic_lui   = 0;
+thread_local uint64_t ic_addi  = 0;
+thread_local uint64_t ic_add   = 0;
+thread_local uint64_t ic_sub   = 0;
+thread_local uint64_t ic_mul   = 0;
+thread_local uint64_t ic_divu  = 0;
+thread_local uint64_t ic_remu  = 0;
+thread_local uint64_t ic_sltu  = 0;
+thread_local uint64_t ic_ld    = 0;
+thread_local uint64_t ic_sd    = 0;
+thread_local uint64_t ic_beq   = 0;
+thread_local uint64_t ic_jal   = 0;
+thread_local uint64_t ic_jalr  = 0;
+thread_local uint64_t ic_ecall = 0;
 
-uint64_t* binary        = (uint64_t*) 0; // binary of code and data segments
-uint64_t  binary_length = 0; // length of binary in bytes including data segment
-uint64_t* binary_name   = (uint64_t*) 0; // file name of binary
+thread_local uint64_t* binary        = (uint64_t*) 0; // binary of code and data segments
+thread_local uint64_t  binary_length = 0; // length of binary in bytes including data segment
+thread_local uint64_t* binary_name   = (uint64_t*) 0; // file name of binary
 
-uint64_t code_length = 0; // length of code segment in binary in bytes
-uint64_t entry_point = 0; // beginning of code segment in virtual address space
+thread_local uint64_t code_length = 0; // length of code segment in binary in bytes
+thread_local uint64_t entry_point = 0; // beginning of code segment in virtual address space
 
-uint64_t* code_line_number = (uint64_t*) 0; // code line number per emitted instruction
-uint64_t* data_line_number = (uint64_t*) 0; // data line number per emitted data
+thread_local uint64_t* code_line_number = (uint64_t*) 0; // code line number per emitted instruction
+thread_local uint64_t* data_line_number = (uint64_t*) 0; // data line number per emitted data
 
-uint64_t* assembly_name = (uint64_t*) 0; // name of assembly file
-uint64_t  assembly_fd   = 0; // file descriptor of open assembly file
+thread_local uint64_t* assembly_name = (uint64_t*) 0; // name of assembly file
+thread_local uint64_t  assembly_fd   = 0; // file descriptor of open assembly file
 
-uint64_t* ELF_header = (uint64_t*) 0;
+thread_local uint64_t* ELF_header = (uint64_t*) 0;
 
 // -----------------------------------------------------------------
 // ----------------------- MIPSTER SYSCALLS ------------------------
@@ -503,10 +509,10 @@ void implement_symbolic_input(uint64_t* context);
 
 // ------------------------ GLOBAL CONSTANTS -----------------------
 
-uint64_t debug_read  = 0;
-uint64_t debug_write = 0;
-uint64_t debug_open  = 0;
-uint64_t debug_brk   = 0;
+thread_local uint64_t debug_read  = 0;
+thread_local uint64_t debug_write = 0;
+thread_local uint64_t debug_open  = 0;
+thread_local uint64_t debug_brk   = 0;
 
 uint64_t SYSCALL_EXIT   = 93;
 uint64_t SYSCALL_READ   = 63;
@@ -518,6 +524,15 @@ uint64_t SYSCALL_ASSERT_ZONE_BGN = 44;
 uint64_t SYSCALL_ASSERT          = 45;
 uint64_t SYSCALL_ASSERT_ZONE_END = 46;
 
+// ------------------------ GLOBAL VARIABLES -----------------------
+
+// -replay feeds symbolic inputs and reads from test vectors
+thread_local uint64_t  replaying       = 0;
+thread_local uint64_t* replay_vector   = (uint64_t*) 0; // numbers of inputs and reads, then their values
+thread_local uint64_t  replay_inputs   = 0; // inputs of replay_vector consumed so far
+thread_local uint64_t  replay_reads    = 0; // reads of replay_vector consumed so far
+thread_local uint64_t  replay_failures = 0; // failed assertions and divisions by zero of the current vector
+
 // *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~
 // -----------------------------------------------------------------
 // ----------------------    R U N T I M E    ----------------------
@@ -548,7 +563,7 @@ void     store_virtual_memory(uint64_t* table, uint64_t vaddr, uint64_t data);
 
 // ------------------------ GLOBAL CONSTANTS -----------------------
 
-uint64_t debug_tlb = 0;
+thread_local uint64_t debug_tlb = 0;
 
 uint64_t MEGABYTE = 1048576; // 1MB
 
@@ -564,7 +579,7 @@ uint64_t PAGESIZE = 4096; // we use standard 4KB pages
 
 // ------------------------ GLOBAL VARIABLES -----------------------
 
-uint64_t page_frame_memory = 0; // size of memory for frames
+thread_local uint64_t page_frame_memory = 0; // size of memory for frames
 
 // ------------------------- INITIALIZATION ------------------------
 
@@ -652,9 +667,9 @@ uint64_t fuzz_up(uint64_t value);
 
 // ------------------------ GLOBAL CONSTANTS -----------------------
 
-uint64_t debug_symbolic = 0;
+thread_local uint64_t debug_symbolic = 0;
 
-uint64_t fuzz = 0; // power-of-two fuzzing factor for read calls
+thread_local uint64_t fuzz = 0; // power-of-two fuzzing factor for read calls
 
 // -----------------------------------------------------------------
 // -------------------------- INTERPRETER --------------------------
@@ -681,6 +696,12 @@ uint64_t instruction_with_max_counter(uint64_t* counters, uint64_t max);
 uint64_t print_per_instruction_counter(uint64_t total, uint64_t* counters, uint64_t max);
 void     print_per_instruction_profile(uint64_t* message, uint64_t total, uint64_t* counters);
 
+void print_query_site(uint64_t* message, uint64_t site);
+void print_query_profile();
+
+uint64_t covered_instructions();
+void     log_coverage();
+void     print_coverage();
 void print_profile();
 
 // ------------------------ GLOBAL CONSTANTS -----------------------
@@ -694,21 +715,21 @@ uint64_t EXCEPTION_DIVISIONBYZERO     = 5;
 uint64_t EXCEPTION_UNKNOWNINSTRUCTION = 6;
 uint64_t EXCEPTION_MAXTRACE           = 7;
 
-uint64_t* EXCEPTIONS; // strings representing exceptions
+thread_local uint64_t* EXCEPTIONS; // strings representing exceptions
 
-uint64_t debug_exception = 0;
+thread_local uint64_t debug_exception = 0;
 
 // enables recording, disassembling, debugging, and symbolically executing code
-uint64_t debug = 0;
+thread_local uint64_t debug = 0;
 
-uint64_t execute     = 0; // flag for executing code
-uint64_t record      = 0; // flag for recording code execution
-uint64_t undo        = 0; // flag for undoing code execution
-uint64_t redo        = 0; // flag for redoing code execution
-uint64_t disassemble = 0; // flag for disassembling code
-uint64_t backtrack   = 0; // flag for backtracking symbolic execution
+thread_local uint64_t execute     = 0; // flag for executing code
+thread_local uint64_t record      = 0; // flag for recording code execution
+thread_local uint64_t undo        = 0; // flag for undoing code execution
+thread_local uint64_t redo        = 0; // flag for redoing code execution
+thread_local uint64_t disassemble = 0; // flag for disassembling code
+thread_local uint64_t backtrack   = 0; // flag for backtracking symbolic execution
 
-uint64_t disassemble_verbose = 0; // flag for disassembling code in more detail
+thread_local uint64_t disassemble_verbose = 0; // flag for disassembling code in more detail
 
 // number of instructions from context switch to timer interrupt
 // CAUTION: avoid interrupting any kernel activities, keep TIMESLICE large
@@ -721,28 +742,28 @@ uint64_t TIMEROFF = 0;
 
 // hardware thread state
 
-uint64_t pc = 0; // program counter
-uint64_t ir = 0; // instruction register
+thread_local uint64_t pc = 0; // program counter
+thread_local uint64_t ir = 0; // instruction register
 
-uint64_t* registers = (uint64_t*) 0; // general-purpose registers
+thread_local uint64_t* registers = (uint64_t*) 0; // general-purpose registers
 
-uint64_t* pt = (uint64_t*) 0; // page table
+thread_local uint64_t* pt = (uint64_t*) 0; // page table
 
 // core state
 
-uint64_t timer = 0; // counter for timer interrupt
-uint64_t trap  = 0; // flag for creating a trap
+thread_local uint64_t timer = 0; // counter for timer interrupt
+thread_local uint64_t trap  = 0; // flag for creating a trap
 
 // profile
 
-uint64_t  calls               = 0;             // total number of executed procedure calls
-uint64_t* calls_per_procedure = (uint64_t*) 0; // number of executed calls of each procedure
+thread_local uint64_t  calls               = 0;             // total number of executed procedure calls
+thread_local uint64_t* calls_per_procedure = (uint64_t*) 0; // number of executed calls of each procedure
 
-uint64_t  iterations          = 0;             // total number of executed loop iterations
-uint64_t* iterations_per_loop = (uint64_t*) 0; // number of executed iterations of each loop
+thread_local uint64_t  iterations          = 0;             // total number of executed loop iterations
+thread_local uint64_t* iterations_per_loop = (uint64_t*) 0; // number of executed iterations of each loop
 
-uint64_t* loads_per_instruction  = (uint64_t*) 0; // number of executed loads per load instruction
-uint64_t* stores_per_instruction = (uint64_t*) 0; // number of executed stores per store instruction
+thread_local uint64_t* loads_per_instruction  = (uint64_t*) 0; // number of executed loads per load instruction
+thread_local uint64_t* stores_per_instruction = (uint64_t*) 0; // number of executed stores per store instruction
 
 // ------------------------- INITIALIZATION ------------------------
 
@@ -876,15 +897,15 @@ void map_page(uint64_t* context, uint64_t page, uint64_t frame);
 
 // ------------------------ GLOBAL CONSTANTS -----------------------
 
-uint64_t debug_create = 0;
-uint64_t debug_map    = 0;
+thread_local uint64_t debug_create = 0;
+thread_local uint64_t debug_map    = 0;
 
 // ------------------------ GLOBAL VARIABLES -----------------------
 
-uint64_t* current_context = (uint64_t*) 0; // context currently running
+thread_local uint64_t* current_context = (uint64_t*) 0; // context currently running
 
-uint64_t* used_contexts = (uint64_t*) 0; // doubly-linked list of used contexts
-uint64_t* free_contexts = (uint64_t*) 0; // singly-linked list of free contexts
+thread_local uint64_t* used_contexts = (uint64_t*) 0; // doubly-linked list of used contexts
+thread_local uint64_t* free_contexts = (uint64_t*) 0; // singly-linked list of free contexts
 
 // ------------------------- INITIALIZATION ------------------------
 
@@ -921,12 +942,20 @@ uint64_t handle_timer(uint64_t* context);
 
 uint64_t handle_exception(uint64_t* context);
 
+void     print_backtracking();
 uint64_t engine(uint64_t* to_context);
+uint64_t parallel_engine(uint64_t* to_context);
 
 // uint64_t is_boot_level_zero();
 
+uint64_t replay_engine(uint64_t* to_context);
+uint64_t selfie_replay();
+
 uint64_t selfie_run(uint64_t machine);
 
+uint64_t selfie(uint64_t argc, uint64_t* argv);
+uint64_t run_explorers(uint64_t argc, uint64_t* argv);
+
 // ------------------------ GLOBAL CONSTANTS -----------------------
 
 uint64_t* MY_CONTEXT = (uint64_t*) 0;
@@ -949,6 +978,7 @@ uint64_t EXITCODE_MULTIPLEEXCEPTIONERROR = 11;
 uint64_t EXITCODE_SYMBOLICEXECUTIONERROR = 12;
 uint64_t EXITCODE_OUTOFTRACEMEMORY       = 13;
 uint64_t EXITCODE_UNCAUGHTEXCEPTION      = 14;
+uint64_t EXITCODE_OUTOFBUDGET            = 15;
 
 uint64_t SYSCALL_BITWIDTH = 32; // integer bit width for system calls
 
@@ -965,10 +995,10 @@ uint64_t HYPSTER = 7;
 
 // ------------------------ GLOBAL VARIABLES -----------------------
 
-uint64_t next_page_frame = 0;
+thread_local uint64_t next_page_frame = 0;
 
-uint64_t allocated_page_frame_memory = 0;
-uint64_t free_page_frame_memory      = 0;
+thread_local uint64_t allocated_page_frame_memory = 0;
+thread_local uint64_t free_page_frame_memory      = 0;
 
 // -----------------------------------------------------------------
 // ----------------------------- MAIN ------------------------------
@@ -985,12 +1015,14 @@ void      set_argument(uint64_t* argv);
 
 void print_usage();
 
+void parse_engine_options();
+
 // ------------------------ GLOBAL VARIABLES -----------------------
 
-uint64_t  selfie_argc = 0;
-uint64_t* selfie_argv = (uint64_t*) 0;
+thread_local uint64_t  selfie_argc = 0;
+thread_local uint64_t* selfie_argv = (uint64_t*) 0;
 
-uint64_t* exe_name = (uint64_t*) 0;
+thread_local uint64_t* exe_name = (uint64_t*) 0;
 
 // ------------------------- INITIALIZATION ------------------------
 
@@ -1218,7 +1250,7 @@ uint64_t atoi(uint64_t* s) {
     if (c > 9) {
       printf2((uint64_t*) "%s: cannot convert non-decimal number %s\n", exe_name, s);
 
-      exit((int) EXITCODE_BADARGUMENTS);
+      exit_explorer(EXITCODE_BADARGUMENTS);
     }
 
     // assert: s contains a decimal number
@@ -1233,13 +1265,13 @@ uint64_t atoi(uint64_t* s) {
         // s contains a decimal number larger than UINT64_MAX
         printf2((uint64_t*) "%s: cannot convert out-of-bound number %s\n", exe_name, s);
 
-        exit((int) EXITCODE_BADARGUMENTS);
+        exit_explorer(EXITCODE_BADARGUMENTS);
       }
     else {
       // s contains a decimal number larger than UINT64_MAX
       printf2((uint64_t*) "%s: cannot convert out-of-bound number %s\n", exe_name, s);
 
-      exit((int) EXITCODE_BADARGUMENTS);
+      exit_explorer(EXITCODE_BADARGUMENTS);
     }
 
     // go to the next digit
@@ -1388,7 +1420,7 @@ void put_character(uint64_t c) {
       printf2((uint64_t*) "%s: could not write character to output file %s\n", exe_name, output_name);
     }
 
-    exit((int) EXITCODE_IOERROR);
+    exit_explorer(EXITCODE_IOERROR);
   }
 }
 
@@ -1620,7 +1652,7 @@ uint64_t* smalloc(uint64_t size) {
   else if ((uint64_t) memory == 0) {
     printf1((uint64_t*) "%s: malloc out of memory\n", exe_name);
 
-    exit((int) EXITCODE_OUTOFVIRTUALMEMORY);
+    exit_explorer(EXITCODE_OUTOFVIRTUALMEMORY);
   }
 
   return memory;
@@ -2079,7 +2111,7 @@ void selfie_load() {
   if (signed_less_than(fd, 0)) {
     printf2((uint64_t*) "%s: could not open input file %s\n", exe_name, binary_name);
 
-    exit((int) EXITCODE_IOERROR);
+    exit_explorer(EXITCODE_IOERROR);
   }
 
   // make sure binary is mapped for reading into it
@@ -2131,7 +2163,7 @@ void selfie_load() {
 
   printf2((uint64_t*) "%s: failed to load code from input file %s\n", exe_name, binary_name);
 
-  exit((int) EXITCODE_IOERROR);
+  exit_explorer(EXITCODE_IOERROR);
 }
 
 // -----------------------------------------------------------------
@@ -2217,8 +2249,8 @@ void implement_read(uint64_t* context) {
 
             printf("reused read: %llu, lo: %llu, up: %llu, read_tc_cur: %llu, read_tc: %llu tc: %llu\n", value, lo,up, read_tc_current, read_tc, sase_tc);
 
-            slv.add(ule(constrained_reads[read_tc_current], ctx.bv_val(up, 64)));
-            slv.add(uge(constrained_reads[read_tc_current], ctx.bv_val(lo, 64)));
+            solver_assert(bv_ule(constrained_reads[read_tc_current], bv_const(up)));
+            solver_assert(bv_uge(constrained_reads[read_tc_current], bv_const(lo)));
 
             sase_store_memory(get_pt(context), vbuffer, SYMBOLIC_T, value, constrained_reads[read_tc_current]);
             read_tc_current++;
@@ -2250,10 +2282,9 @@ void implement_read(uint64_t* context) {
 
               concrete_reads[read_tc] = value;
 
-              sprintf(var_buffer, "rv_%llu", read_tc);
-              constrained_reads[read_tc] = ctx.bv_const(var_buffer, 64);
-              slv.add(ule(constrained_reads[read_tc], ctx.bv_val(up, 64)));
-              slv.add(uge(constrained_reads[read_tc], ctx.bv_val(lo, 64)));
+              constrained_reads[read_tc] = bv_read(read_tc);
+              solver_assert(bv_ule(constrained_reads[read_tc], bv_const(up)));
+              solver_assert(bv_uge(constrained_reads[read_tc], bv_const(lo)));
 
               sase_store_memory(get_pt(context), vbuffer, SYMBOLIC_T, value, constrained_reads[read_tc]);
               read_tc++;
@@ -2261,6 +2292,16 @@ void implement_read(uint64_t* context) {
             }
           }
 
+        } else if (replaying) {
+          // like symbolic reads, a replayed read fills the whole word
+          if (replay_reads < *(replay_vector + 1)) {
+            store_physical_memory(buffer, *(replay_vector + 2 + *replay_vector + replay_reads));
+
+            replay_reads = replay_reads + 1;
+
+            actually_read = bytes_to_read;
+          } else
+            actually_read = 0;
         } else
           actually_read = sign_extend(read(fd, buffer, bytes_to_read), SYSCALL_BITWIDTH);
 
@@ -2300,11 +2341,8 @@ void implement_read(uint64_t* context) {
   else
     *(get_regs(context) + REG_A0) = sign_shrink(-1, SYSCALL_BITWIDTH);
 
-  if (sase_symbolic) {
-    sase_regs[REG_A0]     = ctx.bv_val(*(get_regs(context) + REG_A0), 64);
-
+  if (sase_symbolic)
     sase_regs_typ[REG_A0] = CONCRETE_T;
-  }
 
   set_pc(context, get_pc(context) + INSTRUCTIONSIZE);
 
@@ -2322,14 +2360,16 @@ void implement_assert_begin(uint64_t* context) {
   if (sase_symbolic) {
     assert_zone = 1;
     set_pc(context, get_pc(context) + INSTRUCTIONSIZE);
-  }
+  } else if (replaying)
+    set_pc(context, get_pc(context) + INSTRUCTIONSIZE);
 }
 
 void implement_assert_end(uint64_t* context) {
   if (sase_symbolic) {
     assert_zone = 0;
     set_pc(context, get_pc(context) + INSTRUCTIONSIZE);
-  }
+  } else if (replaying)
+    set_pc(context, get_pc(context) + INSTRUCTIONSIZE);
 }
 
 void implement_assert(uint64_t* context) {
@@ -2339,26 +2379,36 @@ void implement_assert(uint64_t* context) {
     if (which_branch) {
       if (res == 0) {
         printf(RED "assertion failed 1 at %llx\n" RESET, pc - entry_point);
-        exit((int) EXITCODE_SYMBOLICEXECUTIONERROR);
+        sase_emit_test(1);
+        exit_explorer(EXITCODE_SYMBOLICEXECUTIONERROR);
       }
     } else {
-      slv.push();
-      slv.add(sase_false_branchs[sase_tc]);
-      if (slv.check() == sat) {
+      solver_push();
+      solver_assert(sase_false_branchs[sase_tc]);
+      if (sase_check(QUERY_ASSERT, pc) == SOLVER_SAT) {
         printf(RED "assertion failed 2 at %llx\n" RESET, pc - entry_point);
-        exit((int) EXITCODE_SYMBOLICEXECUTIONERROR);
+        sase_emit_test(0);
+        exit_explorer(EXITCODE_SYMBOLICEXECUTIONERROR);
       }
-      slv.pop();
+      solver_pop();
     }
 
     which_branch = 0;
 
+    set_pc(context, get_pc(context) + INSTRUCTIONSIZE);
+  } else if (replaying) {
+    if (res == 0) {
+      printf(RED "assertion failed at %llx\n" RESET, pc - entry_point);
+
+      replay_failures = replay_failures + 1;
+    }
+
     set_pc(context, get_pc(context) + INSTRUCTIONSIZE);
   } else {
     print(exe_name);
     print((uint64_t*) ": symbolic input syscall during concrete execution ");
     println();
-    exit((int) EXITCODE_SYMBOLICEXECUTIONERROR);
+    exit_explorer(EXITCODE_SYMBOLICEXECUTIONERROR);
   }
 }
 
@@ -2380,9 +2430,9 @@ void implement_symbolic_input(uint64_t* context) {
 
     if (input_cnt_current < input_cnt) {
       // <= up
-      slv.add(ule(constrained_inputs[input_cnt_current], ctx.bv_val(up, 64)));
+      solver_assert(bv_ule(constrained_inputs[input_cnt_current], bv_const(up)));
       // >= lo
-      slv.add(uge(constrained_inputs[input_cnt_current], ctx.bv_val(lo, 64)));
+      solver_assert(bv_uge(constrained_inputs[input_cnt_current], bv_const(lo)));
 
       sase_regs[REG_A0] = constrained_inputs[input_cnt_current];
 
@@ -2391,15 +2441,14 @@ void implement_symbolic_input(uint64_t* context) {
     } else {
       if (input_cnt_current > input_cnt) {
         printf("OUTPUT: input_cnt_current > input_cnt \n");
-        exit((int) EXITCODE_SYMBOLICEXECUTIONERROR);
+        exit_explorer(EXITCODE_SYMBOLICEXECUTIONERROR);
       }
 
-      sprintf(var_buffer, "in_%llu", input_cnt);
-      constrained_inputs[input_cnt] = ctx.bv_const(var_buffer, 64);
+      constrained_inputs[input_cnt] = bv_input(input_cnt);
       // <= up
-      slv.add(ule(constrained_inputs[input_cnt], ctx.bv_val(up, 64)));
+      solver_assert(bv_ule(constrained_inputs[input_cnt], bv_const(up)));
       // >= lo
-      slv.add(uge(constrained_inputs[input_cnt], ctx.bv_val(lo, 64)));
+      solver_assert(bv_uge(constrained_inputs[input_cnt], bv_const(lo)));
 
       sase_regs[REG_A0] = constrained_inputs[input_cnt];
 
@@ -2412,11 +2461,21 @@ void implement_symbolic_input(uint64_t* context) {
 
     set_pc(context, get_pc(context) + INSTRUCTIONSIZE);
 
+  } else if (replaying) {
+    // inputs missing in the vector take their lower bound
+    if (replay_inputs < *replay_vector)
+      *(get_regs(context) + REG_A0) = *(replay_vector + 2 + replay_inputs);
+    else
+      *(get_regs(context) + REG_A0) = lo;
+
+    replay_inputs = replay_inputs + 1;
+
+    set_pc(context, get_pc(context) + INSTRUCTIONSIZE);
   } else {
     print(exe_name);
     print((uint64_t*) ": symbolic input syscall during concrete execution ");
     println();
-    exit((int) EXITCODE_SYMBOLICEXECUTIONERROR);
+    exit_explorer(EXITCODE_SYMBOLICEXECUTIONERROR);
   }
 }
 
@@ -2508,11 +2567,8 @@ void implement_write(uint64_t* context) {
   else
     *(get_regs(context) + REG_A0) = sign_shrink(-1, SYSCALL_BITWIDTH);
 
-  if (sase_symbolic) {
-    sase_regs[REG_A0]     = ctx.bv_val(*(get_regs(context) + REG_A0), 64);
-
+  if (sase_symbolic)
     sase_regs_typ[REG_A0] = CONCRETE_T;
-  }
 
   set_pc(context, get_pc(context) + INSTRUCTIONSIZE);
 
@@ -2545,7 +2601,7 @@ uint64_t down_load_string(uint64_t* table, uint64_t vaddr, uint64_t* s) {
             printf1((uint64_t*) "%s: detected symbolic value ", exe_name);
             print((uint64_t*) " in filename of open call\n");
 
-            exit((int) EXITCODE_SYMBOLICEXECUTIONERROR);
+            exit_explorer(EXITCODE_SYMBOLICEXECUTIONERROR);
           }
         } else
           *(s + i) = load_virtual_memory(table, vaddr);
@@ -2612,11 +2668,8 @@ void implement_open(uint64_t* context) {
       printf2((uint64_t*) "%s: opening file with name at virtual address %p failed because the name is too long\n", exe_name, (uint64_t*) vfilename);
   }
 
-  if (sase_symbolic) {
-    sase_regs[REG_A0]     = ctx.bv_val(*(get_regs(context) + REG_A0), 64);
-
+  if (sase_symbolic)
     sase_regs_typ[REG_A0] = CONCRETE_T;
-  }
 
   set_pc(context, get_pc(context) + INSTRUCTIONSIZE);
 
@@ -2664,8 +2717,6 @@ void implement_brk(uint64_t* context) {
     if (sase_symbolic) {
       // assert: program_break < 2^32
       // true for the original malloc code = program_break
-      sase_regs[REG_A0]     = ctx.bv_val(program_break, 64); // no need
-
       sase_regs_typ[REG_A0] = CONCRETE_T;
 
       // size = program_break - previous_program_break;
@@ -2697,10 +2748,8 @@ void implement_brk(uint64_t* context) {
       println();
     }
 
-    if (sase_symbolic) {
-      sase_regs[REG_A0]     = zero_bv;
+    if (sase_symbolic)
       sase_regs_typ[REG_A0] = CONCRETE_T;
-    }
   }
 
   set_pc(context, get_pc(context) + INSTRUCTIONSIZE);
@@ -3308,7 +3357,7 @@ uint64_t load_symbolic_memory(uint64_t* pt, uint64_t vaddr) {
   else {
     printf4((uint64_t*) "%s: detected most recent value counter %d at vaddr %x greater than current trace counter %d\n", exe_name, (uint64_t*) mrvc, (uint64_t*) vaddr, (uint64_t*) tc);
 
-    exit((int) EXITCODE_SYMBOLICEXECUTIONERROR);
+    exit_explorer(EXITCODE_SYMBOLICEXECUTIONERROR);
   }
 }
 
@@ -3380,7 +3429,7 @@ void throw_exception(uint64_t exception, uint64_t faulting_page) {
       print_exception(get_exception(current_context), get_faulting_page(current_context));
       print((uint64_t*) " exception\n");
 
-      exit((int) EXITCODE_MULTIPLEEXCEPTIONERROR);
+      exit_explorer(EXITCODE_MULTIPLEEXCEPTIONERROR);
     }
 
   set_exception(current_context, exception);
@@ -3414,8 +3463,10 @@ void decode_execute() {
     if (funct3 == F3_ADDI) {
       if (debug) {
         if (sase_symbolic) {
-          do_addi();
+          // symbolic semantics first, it needs the operands before
+          // the concrete semantics may overwrite them
           sase_addi();
+          do_addi();
         }
       } else
         do_addi();
@@ -3455,8 +3506,8 @@ void decode_execute() {
       if (funct7 == F7_ADD) {
         if (debug) {
           if (sase_symbolic) {
-            do_add();
             sase_add();
+            do_add();
           }
         } else
           do_add();
@@ -3465,8 +3516,8 @@ void decode_execute() {
       } else if (funct7 == F7_SUB) {
         if (debug) {
           if (sase_symbolic) {
-            do_sub();
             sase_sub();
+            do_sub();
           }
         } else
           do_sub();
@@ -3475,8 +3526,8 @@ void decode_execute() {
       } else if (funct7 == F7_MUL) {
         if (debug) {
           if (sase_symbolic) {
-            do_mul();
             sase_mul();
+            do_mul();
           }
         } else
           do_mul();
@@ -3487,8 +3538,8 @@ void decode_execute() {
       if (funct7 == F7_DIVU) {
         if (debug) {
           if (sase_symbolic) {
-            do_divu();
             sase_divu();
+            do_divu();
           }
         } else
           do_divu();
@@ -3499,8 +3550,8 @@ void decode_execute() {
       if (funct7 == F7_REMU) {
         if (debug) {
           if (sase_symbolic) {
-            do_remu();
             sase_remu();
+            do_remu();
           }
         } else
           do_remu();
@@ -3574,8 +3625,10 @@ void decode_execute() {
 
     if (funct3 == F3_ECALL) {
       if (debug) {
-        if (sase_symbolic)
+        if (sase_symbolic) {
+          sase_ecall();
           do_ecall();
+        }
       } else
         do_ecall();
 
@@ -3591,7 +3644,7 @@ void decode_execute() {
 
     printf2((uint64_t*) "%s: unknown instruction with %x opcode detected\n", exe_name, (uint64_t*) opcode);
 
-    exit((int) EXITCODE_UNKNOWNINSTRUCTION);
+    exit_explorer(EXITCODE_UNKNOWNINSTRUCTION);
   }
 }
 
@@ -3616,6 +3669,14 @@ uint64_t* run_until_exception() {
 
   while (trap == 0) {
     fetch();
+
+    if (coverage != (uint8_t*) 0)
+      if (coverage[(pc - entry_point) / INSTRUCTIONSIZE] == 0) {
+        coverage[(pc - entry_point) / INSTRUCTIONSIZE] = 1;
+
+        new_coverage = 1;
+      }
+
     decode_execute();
     interrupt();
   }
@@ -3684,7 +3745,104 @@ void print_per_instruction_profile(uint64_t* message, uint64_t total, uint64_t*
   println();
 }
 
+void print_query_site(uint64_t* message, uint64_t site) {
+  printf3((uint64_t*) "%s%s%d", exe_name, message, (uint64_t*) (site_results[site * 3] + site_results[site * 3 + 1] + site_results[site * 3 + 2]));
+  printf3((uint64_t*) ",%d,%d,%d", (uint64_t*) site_results[site * 3 + 1], (uint64_t*) site_results[site * 3], (uint64_t*) site_results[site * 3 + 2]);
+  printf4((uint64_t*) ",%d,%d,%d,%d\n",
+    (uint64_t*) site_times[site],
+    (uint64_t*) latency_percentile(site, 50),
+    (uint64_t*) latency_percentile(site, 99),
+    (uint64_t*) site_max_times[site]);
+}
+
+void print_query_profile() {
+  uint64_t queries = 0;
+  uint64_t unknown = 0;
+  uint64_t i       = 0;
+
+  while (i < NUMBER_OF_QUERY_SITES) {
+    queries = queries + site_results[i * 3] + site_results[i * 3 + 1] + site_results[i * 3 + 2];
+    unknown = unknown + site_results[i * 3 + 2];
+
+    i = i + 1;
+  }
+
+  // latencies are in microseconds, percentiles are rounded up to powers of two
+  printf1((uint64_t*) "%s: queries: total,sat,unsat,unknown,time,p50,p99,max(us)\n", exe_name);
+
+  print_query_site((uint64_t*) ": sltu:      ", QUERY_SLTU);
+  print_query_site((uint64_t*) ": backtrack: ", QUERY_BACKTRACK);
+  print_query_site((uint64_t*) ": divu:      ", QUERY_DIVU);
+  print_query_site((uint64_t*) ": remu:      ", QUERY_REMU);
+  print_query_site((uint64_t*) ": assert:    ", QUERY_ASSERT);
+
+  if (lazy_checks) {
+    print_query_site((uint64_t*) ": checkpoint:", QUERY_CHECKPOINT);
+    print_query_site((uint64_t*) ": bisect:    ", QUERY_BISECT);
+  }
+
+  if (test_file_name != 0)
+    print_query_site((uint64_t*) ": test:      ", QUERY_TEST);
+
+  if (use_summaries)
+    print_query_site((uint64_t*) ": summary:   ", QUERY_SUMMARY);
+
+  if (code_line_number != (uint64_t*) 0)
+    printf1((uint64_t*) "%s: profile: total,max(ratio%%)@addr(line#),2max,3max\n", exe_name);
+  else
+    printf1((uint64_t*) "%s: profile: total,max(ratio%%)@addr,2max,3max\n", exe_name);
+
+  print_per_instruction_profile((uint64_t*) ": queries: ", queries, queries_per_instruction);
+  print_per_instruction_profile((uint64_t*) ": unsat:   ", number_of_unsat_queries, unsat_per_instruction);
+
+  if (unknown > 0)
+    print_per_instruction_profile((uint64_t*) ": unknown: ", unknown, unknown_per_instruction);
+
+  print_per_instruction_profile((uint64_t*) ": time(us):", query_time, query_time_per_instruction);
+}
+
+uint64_t covered_instructions() {
+  uint64_t covered = 0;
+  uint64_t i       = 0;
+
+  while (i < code_length / INSTRUCTIONSIZE) {
+    if (coverage[i])
+      covered = covered + 1;
+
+    i = i + 1;
+  }
+
+  return covered;
+}
+
+// appends the milliseconds since the start of the exploration and the
+// number of executed instructions whenever that number has grown
+void log_coverage() {
+  if (coverage_log != 0)
+    if (new_coverage) {
+      fprintf(coverage_log, "%llu %llu\n",
+        (unsigned long long) (wall_clock_milliseconds() - exploration_start),
+        (unsigned long long) covered_instructions());
+
+      new_coverage = 0;
+    }
+}
+
+void print_coverage() {
+  uint64_t covered;
+
+  covered = covered_instructions();
+
+  printf4((uint64_t*) "%s: coverage: %d of %d instructions (%.2d%%) executed\n",
+    exe_name,
+    (uint64_t*) covered,
+    (uint64_t*) (code_length / INSTRUCTIONSIZE),
+    (uint64_t*) fixed_point_percentage(fixed_point_ratio(code_length / INSTRUCTIONSIZE, covered, 4), 4));
+}
+
 void print_profile() {
+  struct rusage usage;
+
   printf4((uint64_t*)
     "%s: summary: %d executed instructions and %.2dMB(%.2d%%) mapped memory\n",
     exe_name,
@@ -3692,6 +3850,15 @@ void print_profile() {
     (uint64_t*) fixed_point_ratio(pused(), MEGABYTE, 2),
     (uint64_t*) fixed_point_percentage(fixed_point_ratio(page_frame_memory, pused(), 4), 4));
 
+  // ru_maxrss is in kilobytes
+  getrusage(RUSAGE_SELF, &usage);
+
+  // explorers share the process and thus its peak
+  if (number_of_explorers > 1)
+    printf3((uint64_t*) "%s: memory: %dMB peak resident set size of all %d explorers\n", exe_name, (uint64_t*) (usage.ru_maxrss / 1024), (uint64_t*) number_of_explorers);
+  else
+    printf2((uint64_t*) "%s: memory: %dMB peak resident set size\n", exe_name, (uint64_t*) (usage.ru_maxrss / 1024));
+
   if (get_total_number_of_instructions() > 0) {
     print_instruction_counters();
 
@@ -3705,6 +3872,70 @@ void print_profile() {
     print_per_instruction_profile((uint64_t*) ": loads:   ", ic_ld, loads_per_instruction);
     print_per_instruction_profile((uint64_t*) ": stores:  ", ic_sd, stores_per_instruction);
   }
+
+  if (number_of_queries > 0)
+    printf4((uint64_t*)
+      "%s: solver: %d queries, %d(%.2d%%) skipped by model reuse\n",
+      exe_name,
+      (uint64_t*) number_of_queries,
+      (uint64_t*) number_of_reused_models,
+      (uint64_t*) fixed_point_percentage(fixed_point_ratio(number_of_queries, number_of_reused_models, 4), 4));
+
+  if (number_of_recreations > 0)
+    printf2((uint64_t*) "%s: solver: %d instances recreated to drop guarded constraints\n", exe_name, (uint64_t*) number_of_recreations);
+
+  if (number_of_unknowns > 0) {
+    if (explore_unknown)
+      printf2((uint64_t*) "%s: solver: %d unknown, explored\n", exe_name, (uint64_t*) number_of_unknowns);
+    else
+      printf2((uint64_t*) "%s: solver: %d unknown, pruned\n", exe_name, (uint64_t*) number_of_unknowns);
+  }
+
+  if (sltu_by_interval + sltu_by_solver > 0)
+    printf4((uint64_t*)
+      "%s: sltu: %d(%.2d%%) symbolic branches decided by intervals, %d by solver\n",
+      exe_name,
+      (uint64_t*) sltu_by_interval,
+      (uint64_t*) fixed_point_percentage(fixed_point_ratio(sltu_by_interval + sltu_by_solver, sltu_by_interval, 4), 4),
+      (uint64_t*) sltu_by_solver);
+
+  if (lazy_checks)
+    printf4((uint64_t*)
+      "%s: lazy: %d deferred branch decisions, %d checkpoints, %d infeasible\n",
+      exe_name,
+      (uint64_t*) deferred_branches,
+      (uint64_t*) number_of_checkpoints,
+      (uint64_t*) infeasible_checkpoints);
+
+  if (test_file_name != 0)
+    printf3((uint64_t*) "%s: tests: %d test vectors written to %s\n", exe_name, (uint64_t*) number_of_tests, (uint64_t*) test_file_name);
+
+  print_coverage();
+
+  if (search != SEARCH_DFS)
+    printf5((uint64_t*) "%s: search: %d restarts, %d resumes, %d cut paths, depth bound %d\n", exe_name,
+      (uint64_t*) number_of_restarts, (uint64_t*) number_of_resumes, (uint64_t*) number_of_cut_paths, (uint64_t*) depth_bound);
+
+  if (merge_regions)
+    printf5((uint64_t*) "%s: merge: %d regions, %d symbolic branches merged over %d instructions, %d aborted\n", exe_name,
+      (uint64_t*) number_of_regions, (uint64_t*) merged_branches, (uint64_t*) merged_instructions, (uint64_t*) aborted_merges);
+
+  if (checkpoint_file_name != 0)
+    printf3((uint64_t*) "%s: checkpoint: exploration saved %d times to %s\n", exe_name, (uint64_t*) number_of_saves, (uint64_t*) checkpoint_file_name);
+
+  if (use_summaries) {
+    printf6((uint64_t*) "%s: summaries: %d shapes, %d paths recorded, %d poisoned, %d calls summarized, %d executed\n", exe_name,
+      (uint64_t*) summary_index.size(), (uint64_t*) recorded_paths, (uint64_t*) poisoned_summaries, (uint64_t*) summary_hits, (uint64_t*) summary_fallbacks);
+
+    if (summary_hits > 0)
+      print_per_instruction_profile((uint64_t*) ": hits:    ", summary_hits, hits_per_procedure);
+  }
+
+  if (number_of_backjumps > 0)
+    printf3((uint64_t*) "%s: backjumping: %d backjumps skipped %d trace levels\n", exe_name, (uint64_t*) number_of_backjumps, (uint64_t*) skipped_levels);
+
+  if (number_of_queries > 0)
+    print_query_profile();
 }
 
 // -----------------------------------------------------------------
@@ -3871,7 +4102,7 @@ uint64_t* palloc() {
       print(exe_name);
       print((uint64_t*) ": palloc out of physical memory\n");
 
-      exit((int) EXITCODE_OUTOFPHYSICALMEMORY);
+      exit_explorer(EXITCODE_OUTOFPHYSICALMEMORY);
     }
   }
 
@@ -3896,8 +4127,7 @@ void map_and_store(uint64_t* context, uint64_t vaddr, uint64_t data) {
     map_page(context, get_page_of_virtual_address(vaddr), (uint64_t) palloc());
 
   if (sase_symbolic) {
-    expr t = ctx.bv_val(data, 64);
-    sase_store_memory(get_pt(context), vaddr, CONCRETE_T, data, t);
+    sase_store_memory(get_pt(context), vaddr, CONCRETE_T, data, 0);
   } else
     store_virtual_memory(get_pt(context), vaddr, data);
 }
@@ -4025,10 +4255,8 @@ void up_load_arguments(uint64_t* context, uint64_t argc, uint64_t* argv) {
   *(get_regs(context) + REG_SP) = SP;
 
   // set bounds to register value for symbolic execution
-  if (sase_symbolic) {
-    sase_regs[REG_SP]     = ctx.bv_val(SP, 64);
+  if (sase_symbolic)
     sase_regs_typ[REG_SP] = CONCRETE_T;
-  }
 }
 
 uint64_t handle_system_call(uint64_t* context) {
@@ -4082,6 +4310,12 @@ uint64_t handle_page_fault(uint64_t* context) {
 uint64_t handle_division_by_zero(uint64_t* context) {
   set_exception(context, EXCEPTION_NOEXCEPTION);
 
+  if (replaying) {
+    printf(RED "division by zero at %llx\n" RESET, pc - entry_point);
+
+    replay_failures = replay_failures + 1;
+  }
+
   // printf1((uint64_t*) "%s: division by zero\n", exe_name);
 
   set_exit_code(context, EXITCODE_DIVISIONBYZERO);
@@ -4089,7 +4323,7 @@ uint64_t handle_division_by_zero(uint64_t* context) {
   return EXIT;
 }
 
-uint64_t is_max_trace_reached = 0;
+thread_local uint64_t is_max_trace_reached = 0;
 
 uint64_t handle_max_trace(uint64_t* context) {
   set_exception(context, EXCEPTION_NOEXCEPTION);
@@ -4136,35 +4370,140 @@ uint64_t handle_exception(uint64_t* context) {
   }
 }
 
+thread_local uint64_t time_budget   = 0; // wall-clock seconds for the whole run, 0 for none
+thread_local uint64_t memory_budget = 0; // maximum resident set size in megabytes, 0 for none
+
+uint64_t is_out_of_budget() {
+  struct rusage usage;
+
+  if (time_budget > 0)
+    if (wall_clock_milliseconds() >= solver_deadline) {
+      printf("time budget of %llus exhausted\n", time_budget);
+
+      return 1;
+    }
+
+  if (memory_budget > 0) {
+    getrusage(RUSAGE_SELF, &usage);
+
+    // ru_maxrss is in kilobytes
+    if ((uint64_t) usage.ru_maxrss >= memory_budget * 1024) {
+      printf("memory budget of %lluMB exhausted\n", memory_budget);
+
+      return 1;
+    }
+  }
+
+  return 0;
+}
+
+void print_backtracking() {
+  // the coordinator of -jobs prints the total of all workers
+  if (worker_id == 0)
+    printf(GREEN "backtracking: %llu\n" RESET, b);
+}
+
 uint64_t engine(uint64_t* to_context) {
   registers = get_regs(to_context);
   pt        = get_pt(to_context);
 
+  // the solver gives up on checks once the time budget is exhausted
+  if (time_budget > 0)
+    solver_deadline = wall_clock_milliseconds() + time_budget * 1000;
+
+  // paths of search strategies other than dfs restart from here
+  if (search != SEARCH_DFS) {
+    pc = get_pc(current_context);
+
+    sase_snapshot();
+  }
+
   while (1) {
     // restore machine state
     pc = get_pc(current_context);
 
+    // budgets and free workers are checked at least once per time slice
+    if (time_budget + memory_budget > 0)
+      timer = TIMESLICE;
+    else if (jobs > 1)
+      timer = TIMESLICE;
+
     run_until_exception();
 
     // save machine state
     set_pc(current_context, pc);
 
-    if (handle_exception(current_context) == EXIT) {
+    // the search has run out of pending branches within an instruction
+    if (sase_symbolic)
+      if (pc == 0) {
+        print_backtracking();
+        return EXITCODE_NOERROR;
+      }
 
-      if (sase_symbolic) {
-        if (sase_tc == 0 || pc == 0) {
-          printf(GREEN "backtracking: %llu\n" RESET, ++b);
-          return EXITCODE_NOERROR;
-        } else {
-          b++;
+    if (is_out_of_budget()) {
+      log_coverage();
+      print_backtracking();
 
-          sase_backtrack_sltu(0);
+      return EXITCODE_OUTOFBUDGET;
+    }
+
+    // deferred branch decisions are checked before system calls and
+    // other exceptions since they are observable or end the path
+    if (sase_symbolic)
+      if (get_exception(current_context) != EXCEPTION_PAGEFAULT)
+        if (sase_checkpoint(pc) == 0) {
+          set_exception(current_context, EXCEPTION_NOEXCEPTION);
           set_pc(current_context, pc);
 
           if (pc == 0) {
-            printf(GREEN "backtracking: %llu\n" RESET, b);
+            print_backtracking();
             return EXITCODE_NOERROR;
           }
+
+          continue;
+        }
+
+    // a new worker leaves the path of its donor behind
+    if (sase_symbolic)
+      if (sase_donate()) {
+        set_exception(current_context, EXCEPTION_NOEXCEPTION);
+        set_pc(current_context, pc);
+
+        if (pc == 0) {
+          print_backtracking();
+          return EXITCODE_NOERROR;
+        }
+
+        continue;
+      }
+
+    if (handle_exception(current_context) == EXIT) {
+
+      if (sase_symbolic) {
+        if (prefix_position < prefix_length) {
+          printf("prefix %s is longer than the path\n", prefix_file_name);
+
+          exit_explorer(EXITCODE_BADARGUMENTS);
+        }
+
+        sase_emit_test(1);
+
+        b++;
+
+        log_coverage();
+
+        if (search != SEARCH_DFS)
+          sase_next_path();
+        else if (sase_tc == sase_base)
+          pc = 0;
+        else if (pc != 0)
+          sase_backtrack_sltu(0);
+
+        set_pc(current_context, pc);
+
+        if (pc == 0) {
+          print_backtracking();
+          return EXITCODE_NOERROR;
         }
       }
 
@@ -4173,6 +4512,187 @@ uint64_t engine(uint64_t* to_context) {
   }
 }
 
+// runs engine in worker processes, see init_jobs. the coordinator
+// only starts the first worker, reaps all of them including those
+// started by other workers, and frees their slots for new ones
+uint64_t parallel_engine(uint64_t* to_context) {
+  uint64_t exit_code;
+  uint64_t number_of_bugs    = 0;
+  uint64_t number_of_failed  = 0;
+  uint64_t is_out_of_budget_ = 0;
+  int      status;
+  pid_t    pid;
+
+  // orphaned workers are reparented to the coordinator
+  prctl(PR_SET_CHILD_SUBREAPER, 1);
+
+  claim_worker();
+
+  fflush(stdout);
+
+  pid = fork();
+
+  if (pid < 0) {
+    printf("%s\n", "cannot fork the first worker");
+
+    return EXITCODE_IOERROR;
+  } else if (pid == 0) {
+    sase_enter_worker();
+
+    atexit(sase_leave_worker);
+
+    exit((int) engine(to_context));
+  }
+
+  while (waitpid(-1, &status, 0) > 0) {
+    if (WIFEXITED(status))
+      exit_code = WEXITSTATUS(status);
+    else
+      exit_code = EXITCODE_UNCAUGHTEXCEPTION;
+
+    if (exit_code == EXITCODE_SYMBOLICEXECUTIONERROR)
+      number_of_bugs = number_of_bugs + 1;
+    else if (exit_code == EXITCODE_OUTOFBUDGET)
+      is_out_of_budget_ = 1;
+    else if (exit_code != EXITCODE_NOERROR)
+      number_of_failed = number_of_failed + 1;
+
+    release_worker();
+  }
+
+  b = *explored_paths;
+
+  printf(GREEN "backtracking: %llu\n" RESET, b);
+
+  printf4((uint64_t*) "%s: jobs: %d workers, %d bugs, %d failed\n",
+    exe_name,
+    (uint64_t*) *started_workers,
+    (uint64_t*) number_of_bugs,
+    (uint64_t*) number_of_failed);
+
+  if (number_of_bugs > 0)
+    return EXITCODE_SYMBOLICEXECUTIONERROR;
+  else if (number_of_failed > 0)
+    return EXITCODE_UNCAUGHTEXCEPTION;
+  else if (is_out_of_budget_)
+    return EXITCODE_OUTOFBUDGET;
+  else
+    return EXITCODE_NOERROR;
+}
+
+uint64_t replay_engine(uint64_t* to_context) {
+  registers = get_regs(to_context);
+  pt        = get_pt(to_context);
+
+  while (1) {
+    pc = get_pc(current_context);
+
+    run_until_exception();
+
+    set_pc(current_context, pc);
+
+    if (handle_exception(current_context) == EXIT)
+      return get_exit_code(current_context);
+  }
+}
+
+// runs the binary on the concrete interpreter once per test vector
+// written by -tests, without any symbolic state or solver
+uint64_t selfie_replay() {
+  uint64_t* vectors;
+  uint64_t  words;
+  uint64_t  size;
+  uint64_t  offset;
+  uint64_t  exit_code;
+  uint64_t  number_of_vectors = 0;
+  uint64_t  number_of_failed  = 0;
+  FILE*     file;
+
+  if (binary_length == 0) {
+    printf("%s\n", "nothing to run");
+
+    return EXITCODE_BADARGUMENTS;
+  }
+
+  file = fopen((char*) peek_argument(), "rb");
+
+  if (file == 0) {
+    printf("cannot read test vectors from %s\n", (char*) peek_argument());
+
+    return EXITCODE_IOERROR;
+  }
+
+  fseek(file, 0, SEEK_END);
+  size = ftell(file);
+  fseek(file, 0, SEEK_SET);
+
+  vectors = smalloc(size + SIZEOFUINT64);
+  words   = fread(vectors, SIZEOFUINT64, size / SIZEOFUINT64, file);
+
+  fclose(file);
+
+  init_memory(4096);
+
+  execute   = 1;
+  replaying = 1;
+
+  reset_interpreter();
+
+  // pass binary name as first argument by replacing the vector file
+  set_argument(binary_name);
+
+  offset = 0;
+
+  while (offset + 2 <= words) {
+    replay_vector = vectors + offset;
+
+    size = 2 + *replay_vector + *(replay_vector + 1);
+
+    if (offset + size > words) {
+      printf2((uint64_t*) "%s: test vector %d is truncated\n", exe_name, (uint64_t*) number_of_vectors);
+
+      break;
+    }
+
+    replay_inputs   = 0;
+    replay_reads    = 0;
+    replay_failures = 0;
+
+    reset_microkernel();
+
+    create_context(MY_CONTEXT, 0);
+
+    up_load_binary(current_context);
+
+    up_load_arguments(current_context, number_of_remaining_arguments(), remaining_arguments());
+
+    exit_code = replay_engine(current_context);
+
+    printf4((uint64_t*) "%s: test vector %d with %d inputs exits with exit code %d\n",
+      exe_name,
+      (uint64_t*) number_of_vectors,
+      (uint64_t*) (*replay_vector + *(replay_vector + 1)),
+      (uint64_t*) sign_extend(exit_code, SYSCALL_BITWIDTH));
+
+    if (replay_failures > 0)
+      number_of_failed = number_of_failed + 1;
+
+    number_of_vectors = number_of_vectors + 1;
+
+    offset = offset + size;
+  }
+
+  printf3((uint64_t*) "%s: replayed %d test vectors, %d failed\n", exe_name, (uint64_t*) number_of_vectors, (uint64_t*) number_of_failed);
+
+  replaying = 0;
+  execute   = 0;
+
+  if (number_of_failed > 0)
+    return EXITCODE_SYMBOLICEXECUTIONERROR;
+  else
+    return EXITCODE_NOERROR;
+}
+
 uint64_t selfie_run(uint64_t machine) {
   uint64_t exit_code;
 
@@ -4208,14 +4728,27 @@ uint64_t selfie_run(uint64_t machine) {
   printf3((uint64_t*) "%s: phantom executing %s with %dMB physical memory \n", exe_name, binary_name, (uint64_t*) (page_frame_memory / MEGABYTE));
   printf("\n");
 
-  exit_code = engine(current_context);
+  if (jobs > 1)
+    exit_code = parallel_engine(current_context);
+  else
+    exit_code = engine(current_context);
+
+  if (split > 0)
+    write_prefixes();
 
   execute = 0;
 
   printf("\n");
   printf3((uint64_t*) "%s: phantom terminating %s with exit code %d\n", exe_name, get_name(current_context), (uint64_t*) sign_extend(exit_code, SYSCALL_BITWIDTH));
 
-  print_profile();
+  // profiles and solver statistics stay with the workers
+  if (jobs > 1)
+    print_coverage();
+  else {
+    print_profile();
+
+    solver_print_statistics();
+  }
 
   sase_symbolic = 0;
   record        = 0;
@@ -4264,21 +4797,272 @@ void set_argument(uint64_t* argv) {
 }
 
 void print_usage() {
-  printf("usage: executable -l binary -sase fuzz \n");
+  printf("usage: executable [ -solver ");
+  print_solvers();
+  printf(" | -portfolio solver,solver,... ] [ -profile ");
+  print_profiles();
+  printf(" ] [ -no-query-cache ] [ -no-model-reuse ] [ -no-slicing ] [ -no-intervals ] [ -no-width-reduction ] [ -assumptions ] [ -dump-queries dir ] [ -timeout ms ] [ -unknown prune|explore ] [ -time-budget s ] [ -memory-budget mb ] [ -lazy n ] [ -jobs n ] [ -search dfs|bfs|random-path|coverage-new|iddfs ] [ -depth n ] [ -prefix file | -split n directory ] [ -merge ] [ -summaries ] [ -checkpoint file s ] [ -resume file ] [ -tests file ] [ -coverage-log file ] -l binary ( -sase fuzz | -replay file ) \n");
 }
 
-int main(uint64_t argc, uint64_t* argv) {
+void parse_engine_options() {
   uint64_t* option;
 
-  init_selfie((uint64_t) argc, (uint64_t*) argv);
+  while (number_of_remaining_arguments() > 0) {
+    option = peek_argument();
+
+    if (string_compare(option, (uint64_t*) "-solver")) {
+      get_argument();
+
+      if (number_of_remaining_arguments() == 0) {
+        print_usage();
+        exit_explorer(EXITCODE_BADARGUMENTS);
+      }
+
+      select_solver((char*) get_argument());
+    } else if (string_compare(option, (uint64_t*) "-profile")) {
+      get_argument();
+
+      if (number_of_remaining_arguments() == 0) {
+        print_usage();
+        exit_explorer(EXITCODE_BADARGUMENTS);
+      }
+
+      select_profile((char*) get_argument());
+    } else if (string_compare(option, (uint64_t*) "-portfolio")) {
+      get_argument();
+
+      if (number_of_remaining_arguments() == 0) {
+        print_usage();
+        exit_explorer(EXITCODE_BADARGUMENTS);
+      }
+
+      select_portfolio((char*) get_argument());
+    } else if (string_compare(option, (uint64_t*) "-no-query-cache")) {
+      get_argument();
+
+      use_query_cache = 0;
+    } else if (string_compare(option, (uint64_t*) "-no-model-reuse")) {
+      get_argument();
+
+      use_model_reuse = 0;
+    } else if (string_compare(option, (uint64_t*) "-no-slicing")) {
+      get_argument();
+
+      use_slicing = 0;
+    } else if (string_compare(option, (uint64_t*) "-no-intervals")) {
+      get_argument();
+
+      use_intervals = 0;
+    } else if (string_compare(option, (uint64_t*) "-no-width-reduction")) {
+      get_argument();
+
+      use_width_reduction = 0;
+    } else if (string_compare(option, (uint64_t*) "-assumptions")) {
+      get_argument();
+
+      use_assumptions = 1;
+    } else if (string_compare(option, (uint64_t*) "-dump-queries")) {
+      get_argument();
+
+      if (number_of_remaining_arguments() == 0) {
+        print_usage();
+        exit_explorer(EXITCODE_BADARGUMENTS);
+      }
+
+      dump_directory = (char*) get_argument();
+    } else if (string_compare(option, (uint64_t*) "-timeout")) {
+      get_argument();
+
+      if (number_of_remaining_arguments() == 0) {
+        print_usage();
+        exit_explorer(EXITCODE_BADARGUMENTS);
+      }
+
+      solver_timeout = atoi(get_argument());
+    } else if (string_compare(option, (uint64_t*) "-unknown")) {
+      get_argument();
+
+      if (number_of_remaining_arguments() == 0) {
+        print_usage();
+        exit_explorer(EXITCODE_BADARGUMENTS);
+      }
+
+      option = get_argument();
+
+      if (string_compare(option, (uint64_t*) "prune"))
+        explore_unknown = 0;
+      else if (string_compare(option, (uint64_t*) "explore"))
+        explore_unknown = 1;
+      else {
+        print_usage();
+        exit_explorer(EXITCODE_BADARGUMENTS);
+      }
+    } else if (string_compare(option, (uint64_t*) "-time-budget")) {
+      get_argument();
+
+      if (number_of_remaining_arguments() == 0) {
+        print_usage();
+        exit_explorer(EXITCODE_BADARGUMENTS);
+      }
+
+      time_budget = atoi(get_argument());
+    } else if (string_compare(option, (uint64_t*) "-memory-budget")) {
+      get_argument();
+
+      if (number_of_remaining_arguments() == 0) {
+        print_usage();
+        exit_explorer(EXITCODE_BADARGUMENTS);
+      }
+
+      memory_budget = atoi(get_argument());
+
+      // the resident set size is that of the whole process
+      if (number_of_explorers > 1) {
+        printf("%s\n", "memory budgets cannot tell several explorer threads apart");
+
+        exit_explorer(EXITCODE_BADARGUMENTS);
+      }
+    } else if (string_compare(option, (uint64_t*) "-lazy")) {
+      get_argument();
+
+      if (number_of_remaining_arguments() == 0) {
+        print_usage();
+        exit_explorer(EXITCODE_BADARGUMENTS);
+      }
+
+      lazy_checks = atoi(get_argument());
+    } else if (string_compare(option, (uint64_t*) "-jobs")) {
+      get_argument();
+
+      if (number_of_remaining_arguments() == 0) {
+        print_usage();
+        exit_explorer(EXITCODE_BADARGUMENTS);
+      }
+
+      jobs = atoi(get_argument());
+
+      if (jobs == 0)
+        jobs = 1;
+    } else if (string_compare(option, (uint64_t*) "-search")) {
+      get_argument();
+
+      if (number_of_remaining_arguments() == 0) {
+        print_usage();
+        exit_explorer(EXITCODE_BADARGUMENTS);
+      }
+
+      option = get_argument();
+
+      if (string_compare(option, (uint64_t*) "dfs"))
+        search = SEARCH_DFS;
+      else if (string_compare(option, (uint64_t*) "bfs"))
+        search = SEARCH_BFS;
+      else if (string_compare(option, (uint64_t*) "random-path"))
+        search = SEARCH_RANDOM_PATH;
+      else if (string_compare(option, (uint64_t*) "coverage-new"))
+        search = SEARCH_COVERAGE_NEW;
+      else if (string_compare(option, (uint64_t*) "iddfs"))
+        search = SEARCH_IDDFS;
+      else {
+        print_usage();
+        exit_explorer(EXITCODE_BADARGUMENTS);
+      }
+    } else if (string_compare(option, (uint64_t*) "-depth")) {
+      get_argument();
+
+      if (number_of_remaining_arguments() == 0) {
+        print_usage();
+        exit_explorer(EXITCODE_BADARGUMENTS);
+      }
+
+      depth_bound = atoi(get_argument());
+
+      if (depth_bound == 0)
+        depth_bound = 1;
+    } else if (string_compare(option, (uint64_t*) "-prefix")) {
+      get_argument();
+
+      if (number_of_remaining_arguments() == 0) {
+        print_usage();
+        exit_explorer(EXITCODE_BADARGUMENTS);
+      }
+
+      prefix_file_name = (char*) get_argument();
+    } else if (string_compare(option, (uint64_t*) "-split")) {
+      get_argument();
+
+      if (number_of_remaining_arguments() < 2) {
+        print_usage();
+        exit_explorer(EXITCODE_BADARGUMENTS);
+      }
+
+      split = atoi(get_argument());
+
+      split_directory = (char*) get_argument();
+    } else if (string_compare(option, (uint64_t*) "-merge")) {
+      get_argument();
+
+      merge_regions = 1;
+    } else if (string_compare(option, (uint64_t*) "-summaries")) {
+      get_argument();
+
+      use_summaries = 1;
+    } else if (string_compare(option, (uint64_t*) "-checkpoint")) {
+      get_argument();
+
+      if (number_of_remaining_arguments() < 2) {
+        print_usage();
+        exit_explorer(EXITCODE_BADARGUMENTS);
+      }
+
+      checkpoint_file_name = (char*) get_argument();
+      checkpoint_interval  = atoi(get_argument());
+    } else if (string_compare(option, (uint64_t*) "-resume")) {
+      get_argument();
+
+      if (number_of_remaining_arguments() == 0) {
+        print_usage();
+        exit_explorer(EXITCODE_BADARGUMENTS);
+      }
+
+      resume_file_name = (char*) get_argument();
+    } else if (string_compare(option, (uint64_t*) "-coverage-log")) {
+      get_argument();
+
+      if (number_of_remaining_arguments() == 0) {
+        print_usage();
+        exit_explorer(EXITCODE_BADARGUMENTS);
+      }
+
+      coverage_log_name = (char*) get_argument();
+    } else if (string_compare(option, (uint64_t*) "-tests")) {
+      get_argument();
+
+      if (number_of_remaining_arguments() == 0) {
+        print_usage();
+        exit_explorer(EXITCODE_BADARGUMENTS);
+      }
+
+      test_file_name = (char*) get_argument();
+    } else
+      return;
+  }
+}
+
+uint64_t selfie(uint64_t argc, uint64_t* argv) {
+  uint64_t* option;
+
+  init_selfie(argc, argv);
+
+  init_library();
+  init_register();
+  init_interpreter();
+
+  parse_engine_options();
 
   if (number_of_remaining_arguments() < 4) {
     print_usage();
   } else {
-    init_library();
-    init_register();
-    init_interpreter();
-
     option = get_argument();
     if (string_compare(option, (uint64_t*) "-l")) {
       selfie_load();
@@ -4290,6 +5074,8 @@ int main(uint64_t argc, uint64_t* argv) {
     option = get_argument();
     if (string_compare(option, (uint64_t*) "-sase")) {
       return selfie_run(SASE);
+    } else if (string_compare(option, (uint64_t*) "-replay")) {
+      return selfie_replay();
     } else {
       print_usage();
       return EXITCODE_BADARGUMENTS;
@@ -4298,4 +5084,112 @@ int main(uint64_t argc, uint64_t* argv) {
   }
 
   return 0;
-}
\ No newline at end of file
+}
+
+uint64_t number_of_explorers = 1;
+
+thread_local uint64_t is_explorer = 0; // runs on a thread of run_explorers
+
+void exit_explorer(uint64_t code) {
+  if (is_explorer) {
+    fflush(stdout);
+
+    // unwinds the explorer only, run_explorers joins the code
+    pthread_exit((void*) code);
+  }
+
+  exit((int) code);
+}
+
+// command holds argc, argv and, once joined, the exit code of the
+// explorer, returned by selfie or passed to exit_explorer
+void* explorer(void* command) {
+  is_explorer = 1;
+
+  return (void*) selfie(*((uint64_t*) command), (uint64_t*) *((uint64_t*) command + 1));
+}
+
+// runs every command line between -- on a thread of its own
+uint64_t run_explorers(uint64_t argc, uint64_t* argv) {
+  uint64_t*  commands;
+  uint64_t*  command;
+  pthread_t* threads;
+  uint64_t   exit_code = EXITCODE_NOERROR;
+  uint64_t   i;
+  uint64_t   j;
+
+  number_of_explorers = 1;
+
+  i = 1;
+
+  while (i < argc) {
+    if (strcmp((char*) *(argv + i), "--") == 0)
+      number_of_explorers = number_of_explorers + 1;
+
+    i = i + 1;
+  }
+
+  commands = (uint64_t*) malloc(number_of_explorers * 3 * sizeof(uint64_t));
+  threads  = (pthread_t*) malloc(number_of_explorers * sizeof(pthread_t));
+
+  i = 1;
+  j = 0;
+
+  while (j < number_of_explorers) {
+    command = commands + j * 3;
+
+    // every command line starts with the name of phantom
+    *command       = 1;
+    *(command + 1) = (uint64_t) malloc((argc + 1) * sizeof(uint64_t));
+
+    *((uint64_t*) *(command + 1)) = *argv;
+
+    while (i < argc) {
+      if (strcmp((char*) *(argv + i), "--") == 0)
+        break;
+
+      *((uint64_t*) *(command + 1) + *command) = *(argv + i);
+
+      *command = *command + 1;
+
+      i = i + 1;
+    }
+
+    *((uint64_t*) *(command + 1) + *command) = 0;
+
+    // skip --
+    i = i + 1;
+
+    pthread_create(threads + j, 0, explorer, command);
+
+    j = j + 1;
+  }
+
+  j = 0;
+
+  while (j < number_of_explorers) {
+    pthread_join(*(threads + j), (void**) (commands + j * 3 + 2));
+
+    printf("%s: explorer %llu exited with code %llu\n", (char*) *argv, j + 1, *(commands + j * 3 + 2));
+
+    if (exit_code == EXITCODE_NOERROR)
+      exit_code = *(commands + j * 3 + 2);
+
+    j = j + 1;
+  }
+
+  return exit_code;
+}
+
+int main(uint64_t argc, uint64_t* argv) {
+  uint64_t i = 1;
+
+  while (i < (uint64_t) argc) {
+    if (strcmp((char*) *((uint64_t*) argv + i), "--") == 0)
+      return run_explorers((uint64_t) argc, (uint64_t*) argv);
+
+    i = i + 1;
+  }
+
+  return selfie((uint64_t) argc, (uint64_t*) argv);
+}
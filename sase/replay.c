@@ -0,0 +1,505 @@
+/*
+  This project contains part of the Selfie Project source code
+  which is governed by a BSD license. For further information
+  and LICENSE conditions see the following website:
+  http://selfie.cs.uni-salzburg.at
+
+  The replay tool re-runs query dumps of phantom -dump-queries
+  against a solver backend and reports per-query latencies, so
+  that backends can be compared without running the engine.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include "solver.h"
+
+uint64_t EXITCODE_NOERROR      = 0;
+uint64_t EXITCODE_BADARGUMENTS = 1;
+uint64_t EXITCODE_IOERROR      = 2;
+
+uint64_t verbose = 0;
+
+void exit_explorer(uint64_t code) {
+  exit((int) code);
+}
+
+// the query being parsed
+char*    source   = 0;
+uint64_t position = 0;
+char     token[4096];
+
+std::unordered_map<std::string, uint64_t> symbols; // declared and defined names
+
+// outcome of every replayed query
+std::vector<uint64_t> latencies; // in microseconds
+uint64_t number_of_sat        = 0;
+uint64_t number_of_unsat      = 0;
+uint64_t number_of_unknown    = 0;
+uint64_t number_of_mismatches = 0; // decided differently than in the dump
+
+// -----------------------------------------------------------------
+// ---------------------------- PARSER -----------------------------
+// -----------------------------------------------------------------
+
+void skip_whitespace_and_comments() {
+  while (source[position] != 0) {
+    if (source[position] == ';')
+      while (source[position] != 0 && source[position] != '\n')
+        position = position + 1;
+    else if (source[position] == ' ' || source[position] == '\t' || source[position] == '\n' || source[position] == '\r')
+      position = position + 1;
+    else
+      return;
+  }
+}
+
+// reads the next parenthesis or atom into token, returns 0 at the end
+uint64_t next_token() {
+  uint64_t i = 0;
+
+  skip_whitespace_and_comments();
+
+  if (source[position] == 0)
+    return 0;
+
+  if (source[position] == '(' || source[position] == ')') {
+    token[0] = source[position];
+    token[1] = 0;
+
+    position = position + 1;
+
+    return 1;
+  }
+
+  while (source[position] != 0) {
+    if (source[position] == '(' || source[position] == ')')
+      break;
+    else if (source[position] == ' ' || source[position] == '\t' || source[position] == '\n' || source[position] == '\r')
+      break;
+    else if (source[position] == ';')
+      break;
+
+    if (i < sizeof(token) - 1) {
+      token[i] = source[position];
+
+      i = i + 1;
+    }
+
+    position = position + 1;
+  }
+
+  token[i] = 0;
+
+  return 1;
+}
+
+uint64_t is_token(const char* s) {
+  return strcmp(token, s) == 0;
+}
+
+void syntax_error(const char* expected) {
+  printf("replay: expected %s but found %s\n", expected, token);
+
+  exit((int) EXITCODE_IOERROR);
+}
+
+void expect(const char* s) {
+  next_token();
+
+  if (is_token(s) == 0)
+    syntax_error(s);
+}
+
+// skips the rest of an s-expression whose opening parenthesis is read
+void skip_expression() {
+  uint64_t depth = 1;
+
+  while (depth > 0) {
+    if (next_token() == 0)
+      syntax_error(")");
+
+    if (is_token("("))
+      depth = depth + 1;
+    else if (is_token(")"))
+      depth = depth - 1;
+  }
+}
+
+uint64_t variable_of(const char* name) {
+  if (strncmp(name, "in_", 3) == 0)
+    return bv_input(strtoull(name + 3, 0, 10));
+  else if (strncmp(name, "rv_", 3) == 0)
+    return bv_read(strtoull(name + 3, 0, 10));
+
+  printf("replay: unknown variable %s\n", name);
+
+  exit((int) EXITCODE_IOERROR);
+}
+
+uint64_t parse_expression() {
+  std::unordered_map<std::string, uint64_t>::iterator it;
+  std::string op;
+  uint64_t    value;
+  uint64_t    c;
+  uint64_t    l;
+  uint64_t    r;
+
+  next_token();
+
+  if (is_token("(") == 0) {
+    it = symbols.find(token);
+
+    if (it == symbols.end())
+      syntax_error("a declared symbol");
+
+    return it->second;
+  }
+
+  next_token();
+
+  if (is_token("_")) {
+    // (_ bvN 64)
+    next_token();
+
+    if (strncmp(token, "bv", 2) != 0)
+      syntax_error("a bit-vector constant");
+
+    value = strtoull(token + 2, 0, 10);
+
+    expect("64");
+    expect(")");
+
+    return bv_const(value);
+  }
+
+  op = token;
+
+  if (op == "ite") {
+    c = parse_expression();
+    l = parse_expression();
+    r = parse_expression();
+
+    expect(")");
+
+    return bv_ite(c, l, r);
+  }
+
+  l = parse_expression();
+  r = parse_expression();
+
+  expect(")");
+
+  if (op == "bvadd")
+    return bv_add(l, r);
+  else if (op == "bvsub")
+    return bv_sub(l, r);
+  else if (op == "bvmul")
+    return bv_mul(l, r);
+  else if (op == "bvudiv")
+    return bv_udiv(l, r);
+  else if (op == "bvurem")
+    return bv_urem(l, r);
+  else if (op == "bvult")
+    return bv_ult(l, r);
+  else if (op == "bvuge")
+    return bv_uge(l, r);
+  else if (op == "bvule")
+    return bv_ule(l, r);
+  else if (op == "=")
+    return bv_eq(l, r);
+
+  printf("replay: unsupported operator %s\n", op.c_str());
+
+  exit((int) EXITCODE_IOERROR);
+}
+
+// -----------------------------------------------------------------
+// ---------------------------- REPLAY -----------------------------
+// -----------------------------------------------------------------
+
+char* read_file(const char* name) {
+  FILE*    file;
+  char*    buffer;
+  uint64_t size;
+
+  file = fopen(name, "r");
+
+  if (file == 0) {
+    printf("replay: cannot read %s\n", name);
+
+    exit((int) EXITCODE_IOERROR);
+  }
+
+  fseek(file, 0, SEEK_END);
+  size = ftell(file);
+  fseek(file, 0, SEEK_SET);
+
+  buffer = (char*) malloc(size + 1);
+
+  size = fread(buffer, 1, size, file);
+
+  buffer[size] = 0;
+
+  fclose(file);
+
+  return buffer;
+}
+
+void check(const char* name, uint64_t expected) {
+  uint64_t start;
+  uint64_t result;
+  uint64_t microseconds;
+
+  start = wall_clock_microseconds();
+
+  result = backend->check(slv);
+
+  microseconds = wall_clock_microseconds() - start;
+
+  latencies.push_back(microseconds);
+
+  if (result == SOLVER_SAT)
+    number_of_sat = number_of_sat + 1;
+  else if (result == SOLVER_UNSAT)
+    number_of_unsat = number_of_unsat + 1;
+  else
+    number_of_unknown = number_of_unknown + 1;
+
+  if (result != SOLVER_UNKNOWN)
+    if (expected != SOLVER_UNKNOWN)
+      if (result != expected) {
+        number_of_mismatches = number_of_mismatches + 1;
+
+        printf("replay: %s is %s but was dumped as %s\n", name, result_name(result), result_name(expected));
+      }
+
+  if (verbose)
+    printf("replay: %s %s in %llu us\n", name, result_name(result), (unsigned long long) microseconds);
+}
+
+void replay_file(const char* name) {
+  std::string symbol;
+  uint64_t    expected = SOLVER_UNKNOWN;
+
+  source   = read_file(name);
+  position = 0;
+
+  symbols.clear();
+
+  backend->push(slv);
+
+  while (next_token()) {
+    if (is_token("(") == 0)
+      syntax_error("(");
+
+    next_token();
+
+    if (is_token("declare-fun")) {
+      next_token();
+
+      symbols[token] = variable_of(token);
+
+      skip_expression();
+    } else if (is_token("define-fun")) {
+      next_token();
+
+      symbol = token;
+
+      // skip the empty parameter list and the sort
+      expect("(");
+      expect(")");
+
+      next_token();
+
+      if (is_token("("))
+        skip_expression();
+
+      symbols[symbol] = parse_expression();
+
+      expect(")");
+    } else if (is_token("assert")) {
+      backend->assert_formula(slv, parse_expression());
+
+      expect(")");
+    } else if (is_token("check-sat")) {
+      check(name, expected);
+
+      expect(")");
+    } else if (is_token("set-info")) {
+      next_token();
+
+      if (is_token(":status")) {
+        next_token();
+
+        if (is_token("sat"))
+          expected = SOLVER_SAT;
+        else if (is_token("unsat"))
+          expected = SOLVER_UNSAT;
+
+        expect(")");
+      } else
+        skip_expression();
+    } else
+      // set-logic, exit and others
+      skip_expression();
+  }
+
+  backend->pop(slv);
+
+  free(source);
+}
+
+void replay_path(const char* path) {
+  std::vector<std::string> names;
+  struct stat    status;
+  struct dirent* entry;
+  DIR*           directory;
+  uint64_t       i;
+
+  if (stat(path, &status) != 0) {
+    printf("replay: cannot find %s\n", path);
+
+    exit((int) EXITCODE_IOERROR);
+  }
+
+  if (S_ISDIR(status.st_mode) == 0) {
+    replay_file(path);
+
+    return;
+  }
+
+  directory = opendir(path);
+
+  entry = readdir(directory);
+
+  while (entry != 0) {
+    if (strstr(entry->d_name, ".smt2") != 0)
+      names.push_back(std::string(path) + "/" + entry->d_name);
+
+    entry = readdir(directory);
+  }
+
+  closedir(directory);
+
+  // replay in the order of the dump
+  std::sort(names.begin(), names.end());
+
+  i = 0;
+
+  while (i < names.size()) {
+    replay_file(names[i].c_str());
+
+    i = i + 1;
+  }
+}
+
+uint64_t percentile(uint64_t p) {
+  // latencies are sorted
+  return latencies[(latencies.size() - 1) * p / 100];
+}
+
+void print_latencies() {
+  uint64_t total = 0;
+  uint64_t i     = 0;
+
+  printf("replay: %llu queries with %s (%s), %llu sat, %llu unsat, %llu unknown, %llu mismatches\n",
+    (unsigned long long) latencies.size(), backend->name, solver_profile,
+    (unsigned long long) number_of_sat, (unsigned long long) number_of_unsat,
+    (unsigned long long) number_of_unknown, (unsigned long long) number_of_mismatches);
+
+  if (latencies.size() == 0)
+    return;
+
+  while (i < latencies.size()) {
+    total = total + latencies[i];
+
+    i = i + 1;
+  }
+
+  std::sort(latencies.begin(), latencies.end());
+
+  printf("replay: latency total %llu us, mean %llu us\n",
+    (unsigned long long) total, (unsigned long long) (total / latencies.size()));
+  printf("replay: latency p50 %llu us, p90 %llu us, p99 %llu us, max %llu us\n",
+    (unsigned long long) percentile(50), (unsigned long long) percentile(90),
+    (unsigned long long) percentile(99), (unsigned long long) latencies.back());
+}
+
+void print_usage() {
+  printf("usage: replay [ -solver ");
+  print_solvers();
+  printf(" ] [ -profile ");
+  print_profiles();
+  printf(" ] [ -timeout ms ] [ -v ] query.smt2|directory ...\n");
+}
+
+int main(int argc, char** argv) {
+  int i = 1;
+
+  while (i < argc) {
+    if (strcmp(argv[i], "-solver") == 0) {
+      if (i + 1 == argc) {
+        print_usage();
+
+        return EXITCODE_BADARGUMENTS;
+      }
+
+      select_solver(argv[i + 1]);
+
+      i = i + 2;
+    } else if (strcmp(argv[i], "-profile") == 0) {
+      if (i + 1 == argc) {
+        print_usage();
+
+        return EXITCODE_BADARGUMENTS;
+      }
+
+      select_profile(argv[i + 1]);
+
+      i = i + 2;
+    } else if (strcmp(argv[i], "-timeout") == 0) {
+      if (i + 1 == argc) {
+        print_usage();
+
+        return EXITCODE_BADARGUMENTS;
+      }
+
+      solver_timeout = strtoull(argv[i + 1], 0, 10);
+
+      i = i + 2;
+    } else if (strcmp(argv[i], "-v") == 0) {
+      verbose = 1;
+
+      i = i + 1;
+    } else
+      break;
+  }
+
+  if (i == argc) {
+    print_usage();
+
+    return EXITCODE_BADARGUMENTS;
+  }
+
+  init_solver();
+
+  if (solver_timeout > 0)
+    if (backend->set_timeout != 0)
+      backend->set_timeout(slv, solver_timeout);
+
+  while (i < argc) {
+    replay_path(argv[i]);
+
+    i = i + 1;
+  }
+
+  print_latencies();
+
+  return EXITCODE_NOERROR;
+}
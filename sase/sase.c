@@ -0,0 +1,3339 @@
+/*
+  This project contains part of the Selfie Project source code
+  which is governed by a BSD license. For further information
+  and LICENSE conditions see the following website:
+  http://selfie.cs.uni-salzburg.at
+
+  Furthermore this project uses the api of the SMT solvers
+  z3, cvc4, and boolector through the solver interface
+*/
+
+#include "sase.h"
+
+// -----------------------------------------------------------------
+// ---------------- Solver Aided Symbolic Execution ----------------
+// -----------------------------------------------------------------
+
+thread_local uint64_t  zero_bv;
+thread_local uint64_t  one_bv;
+
+thread_local uint64_t  sase_symbolic = 0; // flag for symbolically executing code
+thread_local uint64_t  b             = 0; // counting total number of backtracking
+uint64_t  SASE          = 8; // Solver Aided Symbolic Execution
+uint8_t   CONCRETE_T    = 0; // concrete value type
+uint8_t   SYMBOLIC_T    = 1; // symbolic value type
+
+thread_local uint64_t  sltu_by_interval = 0; // symbolic sltu decided by the interval domain
+thread_local uint64_t  sltu_by_solver   = 0; // symbolic sltu decided by the solver
+
+thread_local uint64_t  explore_unknown = 0; // branches the solver cannot decide are explored, not pruned
+
+thread_local uint64_t  number_of_backjumps = 0;
+thread_local uint64_t  skipped_levels      = 0; // trace levels whose false branch needed no check
+
+thread_local uint64_t  lazy_checks            = 0; // branch decisions checked at once, 0 checks every decision
+thread_local uint64_t  pending_branches       = 0; // decisions taken since the last check
+thread_local uint64_t  feasible_length        = 0; // length of the path prefix known to be feasible
+thread_local uint64_t  deferred_branches      = 0;
+thread_local uint64_t  number_of_checkpoints  = 0;
+thread_local uint64_t  infeasible_checkpoints = 0;
+
+thread_local char*     test_file_name  = 0;
+thread_local FILE*     test_file       = 0;
+thread_local uint64_t  number_of_tests = 0;
+
+// parallel exploration, the counters below live in memory shared by all workers
+thread_local uint64_t  jobs                = 1; // number of worker processes
+thread_local uint64_t  worker_id           = 0; // 0 in the coordinator and without -jobs
+thread_local uint64_t* free_workers        = (uint64_t*) 0; // workers which may still be started
+thread_local uint64_t* started_workers     = (uint64_t*) 0;
+thread_local uint64_t* explored_paths      = (uint64_t*) 0; // backtracking of all finished workers
+thread_local uint64_t  number_of_donations = 0;
+
+thread_local uint8_t*  coverage = (uint8_t*) 0; // executed instructions of all workers
+
+thread_local char*     coverage_log_name = 0;
+thread_local FILE*     coverage_log      = 0;
+thread_local uint64_t  new_coverage      = 0; // instructions executed for the first time since the last log entry
+thread_local uint64_t  exploration_start = 0; // in milliseconds
+
+// search strategies
+uint64_t  SEARCH_DFS          = 0;
+uint64_t  SEARCH_BFS          = 1;
+uint64_t  SEARCH_RANDOM_PATH  = 2;
+uint64_t  SEARCH_COVERAGE_NEW = 3;
+uint64_t  SEARCH_IDDFS        = 4;
+
+thread_local uint64_t  search       = 0;  // SEARCH_DFS
+thread_local uint64_t  depth_bound  = 16; // of iterative deepening, doubled whenever the tree within is explored
+thread_local uint64_t  random_state = 1;
+
+// path tree of the search, node 0 is the root
+thread_local uint64_t* node_parents        = (uint64_t*) 0;
+thread_local uint64_t* node_pcs            = (uint64_t*) 0; // first instruction of the branch
+thread_local uint64_t* node_depths         = (uint64_t*) 0;
+thread_local uint8_t*  node_decisions      = (uint8_t*) 0;  // 1 if the branch is the true one
+thread_local uint64_t* node_branches       = (uint64_t*) 0; // sltu of the decision relative to entry_point
+thread_local uint64_t* node_inputs         = (uint64_t*) 0; // input and read counters at the decision
+thread_local uint64_t* node_reads          = (uint64_t*) 0;
+thread_local uint64_t  number_of_nodes     = 0;
+thread_local uint64_t  max_number_of_nodes = 0;
+thread_local uint64_t  current_node        = 0;
+
+thread_local std::vector<uint64_t> frontier;     // nodes of the pending branches
+thread_local std::vector<uint64_t> forced_nodes; // path of a restarted execution from the root
+thread_local uint64_t  forced_position = 0;
+
+// machine state at the start of the program to which paths restart
+thread_local uint64_t* root_registers;
+thread_local uint64_t* root_sase_regs;
+thread_local uint8_t*  root_sase_regs_typ;
+thread_local uint64_t  root_program_break = 0;
+thread_local uint64_t  root_pc            = 0;
+thread_local uint64_t  root_tc            = 0;
+
+// path prefixes name the subtree beneath a sequence of branch
+// decisions, see sase_replay_prefix
+thread_local char*     prefix_file_name  = 0;
+thread_local uint64_t  split             = 0; // number of prefixes written by -split, 0 if none
+thread_local char*     split_directory   = 0;
+thread_local uint64_t* prefix_branches   = (uint64_t*) 0;
+thread_local uint8_t*  prefix_decisions  = (uint8_t*) 0;
+thread_local uint64_t  prefix_length     = 0;
+thread_local uint64_t  prefix_inputs     = 0;
+thread_local uint64_t  prefix_reads      = 0;
+thread_local uint64_t  prefix_position   = 0;
+thread_local uint64_t  prefix_checked    = 0;
+
+// a long exploration is saved as its current path every
+// checkpoint_interval seconds and resumed from it, see save_exploration
+thread_local char*     checkpoint_file_name = 0;
+thread_local uint64_t  checkpoint_interval  = 0; // in seconds
+thread_local uint64_t  next_checkpoint      = 0; // wall-clock milliseconds of the next save
+thread_local char*     resume_file_name     = 0;
+thread_local uint64_t  number_of_saves      = 0;
+thread_local uint64_t* sase_decision_ptrs;        // position of the true decision of each level in the path
+thread_local std::vector<uint64_t> path_branches;  // relative to the entry point
+thread_local std::vector<uint8_t>  path_decisions; // 1 for the true and 0 for the false branch
+
+thread_local uint64_t  number_of_restarts  = 0;
+thread_local uint64_t  number_of_resumes   = 0;
+thread_local uint64_t  number_of_cut_paths = 0;
+
+// merging of short acyclic regions
+thread_local uint64_t  merge_regions       = 0;  // symbolic branches of regions are merged instead of forked
+uint64_t  MAX_REGION_LENGTH   = 16; // instructions on either side of a region
+thread_local uint64_t* join_points         = (uint64_t*) 0; // of the beq at each instruction, 0 if none
+thread_local uint64_t  number_of_regions   = 0;
+thread_local uint64_t  merged_branches     = 0;
+thread_local uint64_t  merged_instructions = 0;
+thread_local uint64_t  aborted_merges      = 0; // regions accessing symbolic or unmapped addresses
+
+thread_local uint64_t* merge_values  = (uint64_t*) 0; // registers of both sides, the true one first
+thread_local uint64_t* merge_terms   = (uint64_t*) 0;
+thread_local uint8_t*  merge_types   = (uint8_t*)  0;
+thread_local uint8_t*  merge_written = (uint8_t*)  0;
+
+thread_local std::vector<uint64_t> merge_stores[2]; // vaddr, type, value and term of each store of a side
+
+// function summaries
+thread_local uint64_t  use_summaries        = 0; // calls are replaced by recorded paths of their callee
+uint64_t  MAX_PARAMETERS       = 8; // stack words a summarized callee may pop
+thread_local uint64_t* procedure_parameters = (uint64_t*) 0; // words popped + 1 by each procedure, 0 before its first return
+thread_local uint64_t* hits_per_procedure   = (uint64_t*) 0;
+thread_local uint64_t  summary_hits         = 0;
+thread_local uint64_t  summary_fallbacks    = 0; // calls of a summarizable shape executed anyway
+thread_local uint64_t  recorded_paths       = 0;
+thread_local uint64_t  poisoned_summaries   = 0;
+
+uint64_t  SUMMARY_EMPTY     = 0;
+uint64_t  SUMMARY_RECORDING = 1; // paths are recorded until the call is backtracked
+uint64_t  SUMMARY_COMPLETE  = 2; // all paths of the callee are recorded
+uint64_t  SUMMARY_POISONED  = 3; // the callee depends on or affects more than its shape
+
+// summary 0 is none
+thread_local std::map<std::vector<uint64_t>, uint64_t> summary_index; // shape of a call to its summary
+thread_local std::vector<uint64_t> summary_states;
+thread_local std::vector<uint64_t> summary_levels; // trace level of the recording call
+thread_local std::vector<std::vector<uint64_t>> summary_starts; // of each path in summary_paths
+thread_local std::vector<uint64_t> summary_paths;
+thread_local std::vector<uint64_t> recording_summaries;
+
+// activations of the calls on the current path, activation 0 is none
+thread_local std::vector<uint64_t> activation_parents;
+thread_local std::vector<uint64_t> activation_returns; // return address
+thread_local std::vector<uint64_t> activation_sps;     // stack pointer at the call
+thread_local std::vector<uint64_t> activation_procedures;
+thread_local std::vector<uint64_t> activation_summaries; // recorded by the activation, 0 if none
+thread_local std::vector<uint64_t> activation_recorders; // innermost activation recording a summary
+thread_local std::vector<uint64_t> activation_logs;      // start in summary_log
+thread_local std::vector<uint64_t> argument_terms;       // MAX_PARAMETERS per activation
+thread_local uint64_t  current_activation = 0;
+thread_local uint64_t* call_arguments     = (uint64_t*) 0;
+
+// decisions (0, condition), loads (vaddr, 1) and stores (vaddr, 0)
+// of recording activations on the current path
+thread_local std::vector<uint64_t> summary_log;
+thread_local uint64_t  summary_resumed = 0; // summary whose path + 1 summary_next is tried at the next call
+thread_local uint64_t  summary_next    = 0;
+
+uint64_t  QUERY_SLTU            = 0;
+uint64_t  QUERY_BACKTRACK       = 1;
+uint64_t  QUERY_DIVU            = 2;
+uint64_t  QUERY_REMU            = 3;
+uint64_t  QUERY_ASSERT          = 4;
+uint64_t  QUERY_CHECKPOINT      = 5;
+uint64_t  QUERY_BISECT          = 6;
+uint64_t  QUERY_TEST            = 7;
+uint64_t  QUERY_SUMMARY         = 8;
+uint64_t  NUMBER_OF_QUERY_SITES = 9;
+
+uint64_t  LATENCY_BUCKETS = 64; // bucket i counts latencies below 2^i microseconds
+
+thread_local uint64_t* site_results   = (uint64_t*) 0;
+thread_local uint64_t* site_times     = (uint64_t*) 0;
+thread_local uint64_t* site_max_times = (uint64_t*) 0;
+thread_local uint64_t* site_latencies = (uint64_t*) 0;
+
+thread_local uint64_t  query_time                 = 0;
+thread_local uint64_t  number_of_unsat_queries    = 0;
+thread_local uint64_t* queries_per_instruction    = (uint64_t*) 0;
+thread_local uint64_t* unsat_per_instruction      = (uint64_t*) 0;
+thread_local uint64_t* unknown_per_instruction    = (uint64_t*) 0;
+thread_local uint64_t* query_time_per_instruction = (uint64_t*) 0;
+
+// symbolic registers
+thread_local uint64_t* sase_regs;         // array of solver terms
+thread_local uint8_t*  sase_regs_typ;     // CONCRETE_T or SYMBOLIC_T
+
+// engine trace
+thread_local uint64_t  sase_trace_size = 10000000;
+thread_local uint64_t  sase_tc         = 0;    // trace counter
+thread_local uint64_t* sase_pcs;
+thread_local uint64_t* sase_false_branchs;
+thread_local uint64_t* sase_read_trace_ptrs;   // pointers to read trace
+thread_local uint64_t* sase_program_brks;      // keep track of program_break
+thread_local uint64_t* sase_store_trace_ptrs;  // pointers to store trace
+thread_local uint64_t* sase_rds;
+thread_local uint64_t  mrif          = 0;      // most recent conditional expression
+thread_local uint64_t  sase_base     = 0;      // trace levels below belong to other workers
+thread_local uint8_t*  sase_donated;           // false branch is explored by another worker
+thread_local uint64_t* sase_pending_nodes;     // node of the false branch in the frontier, 0 if none
+thread_local uint64_t* sase_activations;       // current activation at the branch
+thread_local uint64_t* sase_activation_counts;
+thread_local uint64_t* sase_summary_logs;
+thread_local uint64_t* sase_summary_ids;       // summary tried on backtracking, 0 if none
+thread_local uint64_t* sase_summary_nexts;     // path + 1 of that summary
+thread_local uint8_t   which_branch  = 0;      // which branch is taken
+thread_local uint8_t   assert_zone   = 0;      // is assertion zone?
+
+// store trace
+thread_local uint64_t  tc            = 0;
+thread_local uint64_t* tcs;
+thread_local uint64_t* vaddrs;
+thread_local uint64_t* values;
+thread_local uint8_t*  is_symbolics;
+thread_local uint64_t* symbolic_values;
+
+// read trace
+thread_local uint64_t* concrete_reads;
+thread_local uint64_t* constrained_reads;
+thread_local uint64_t  read_tc         = 0;
+thread_local uint64_t  read_tc_current = 0;
+thread_local uint64_t  read_buffer     = 0;
+
+// input trace
+thread_local uint64_t* constrained_inputs;
+thread_local uint64_t* sase_input_trace_ptrs;
+thread_local uint64_t  input_cnt         = 0;
+thread_local uint64_t  input_cnt_current = 0;
+
+// ********************** engine functions ************************
+
+void init_sase() {
+  init_solver();
+
+  if (test_file_name != 0) {
+    test_file = fopen(test_file_name, "wb");
+
+    if (test_file == 0) {
+      printf("cannot write test vectors to %s\n", test_file_name);
+
+      exit_explorer(EXITCODE_IOERROR);
+    }
+
+    // each vector is written at once so that vectors of parallel
+    // workers do not interleave in the file they share
+    if (jobs > 1)
+      setvbuf(test_file, 0, _IONBF, 0);
+  }
+
+  if (coverage_log_name != 0) {
+    coverage_log = fopen(coverage_log_name, "w");
+
+    if (coverage_log == 0) {
+      printf("cannot write coverage log to %s\n", coverage_log_name);
+
+      exit_explorer(EXITCODE_IOERROR);
+    }
+
+    if (jobs > 1)
+      setvbuf(coverage_log, 0, _IONBF, 0);
+  }
+
+  exploration_start = wall_clock_milliseconds();
+
+  if (prefix_file_name != 0)
+    read_prefix();
+
+  // splitting is a breadth-first search which stops early
+  if (split > 0)
+    search = SEARCH_BFS;
+
+  // summaries are complete once the recording call is backtracked
+  // which needs every path beneath it explored by the same process
+  if (use_summaries) {
+    if (search != SEARCH_DFS) {
+      printf("%s\n", "summaries only search depth-first");
+
+      exit_explorer(EXITCODE_BADARGUMENTS);
+    }
+
+    if (jobs > 1) {
+      printf("%s\n", "summaries cannot be shared among jobs");
+
+      exit_explorer(EXITCODE_BADARGUMENTS);
+    }
+
+    if (lazy_checks) {
+      printf("%s\n", "summaries need every decision checked at once");
+
+      exit_explorer(EXITCODE_BADARGUMENTS);
+    }
+
+    if (prefix_file_name != 0) {
+      printf("%s\n", "summaries cannot replay prefixes");
+
+      exit_explorer(EXITCODE_BADARGUMENTS);
+    }
+  }
+
+  // a saved exploration is a single depth-first path of one process
+  if (checkpoint_file_name != 0 || resume_file_name != 0) {
+    if (search != SEARCH_DFS) {
+      printf("%s\n", "checkpoints only save depth-first searches");
+
+      exit_explorer(EXITCODE_BADARGUMENTS);
+    }
+
+    if (jobs > 1) {
+      printf("%s\n", "checkpoints cannot save the paths of other jobs");
+
+      exit_explorer(EXITCODE_BADARGUMENTS);
+    }
+
+    if (number_of_explorers > 1) {
+      printf("%s\n", "checkpoints cannot save several explorer threads");
+
+      exit_explorer(EXITCODE_BADARGUMENTS);
+    }
+
+    if (lazy_checks) {
+      printf("%s\n", "checkpoints need every decision checked at once");
+
+      exit_explorer(EXITCODE_BADARGUMENTS);
+    }
+
+    if (use_summaries) {
+      printf("%s\n", "checkpoints cannot save summaries");
+
+      exit_explorer(EXITCODE_BADARGUMENTS);
+    }
+
+    if (prefix_file_name != 0) {
+      printf("%s\n", "checkpoints cannot save the subtree of a prefix");
+
+      exit_explorer(EXITCODE_BADARGUMENTS);
+    }
+
+    if (resume_file_name != 0)
+      load_exploration();
+
+    next_checkpoint = exploration_start + checkpoint_interval * 1000;
+  }
+
+  if (search != SEARCH_DFS) {
+    if (jobs > 1) {
+      printf("%s\n", "jobs only search depth-first");
+
+      exit_explorer(EXITCODE_BADARGUMENTS);
+    }
+
+    if (lazy_checks) {
+      printf("%s\n", "lazy checks only search depth-first");
+
+      exit_explorer(EXITCODE_BADARGUMENTS);
+    }
+
+    if (backend_holds_assertions()) {
+      printf("%s\n", "search strategies other than dfs need slicing or assumptions");
+
+      exit_explorer(EXITCODE_BADARGUMENTS);
+    }
+  }
+
+  if (jobs > 1)
+    if (number_of_explorers > 1) {
+      printf("%s\n", "jobs cannot fork one of several explorer threads");
+
+      exit_explorer(EXITCODE_BADARGUMENTS);
+    }
+
+  if (jobs > 1)
+    if (backend == &portfolio_backend) {
+      printf("%s\n", "jobs cannot fork the threads of the portfolio");
+
+      exit_explorer(EXITCODE_BADARGUMENTS);
+    }
+
+  if (lazy_checks)
+    if (backend_holds_assertions()) {
+      printf("%s\n", "lazy checks need slicing or assumptions");
+
+      exit_explorer(EXITCODE_BADARGUMENTS);
+    }
+
+  zero_bv = bv_const(0);
+  one_bv  = bv_const(1);
+
+  if (merge_regions)
+    find_join_points();
+
+  sase_regs              = (uint64_t*) malloc(sizeof(uint64_t) * NUMBEROFREGISTERS);
+  sase_regs_typ          = (uint8_t*) malloc(sizeof(uint8_t) * NUMBEROFREGISTERS);
+  for (size_t i = 0; i < NUMBEROFREGISTERS; i++) {
+    sase_regs_typ[i] = CONCRETE_T;
+  }
+  sase_regs[REG_ZR] = zero_bv;
+  sase_regs[REG_FP] = zero_bv;
+
+  sase_pcs              = (uint64_t*) malloc(sizeof(uint64_t) * sase_trace_size);
+  sase_false_branchs    = (uint64_t*) malloc(sizeof(uint64_t) * sase_trace_size);
+  sase_read_trace_ptrs  = (uint64_t*) malloc(sizeof(uint64_t) * sase_trace_size);
+  sase_program_brks     = (uint64_t*) malloc(sizeof(uint64_t) * sase_trace_size);
+  sase_store_trace_ptrs = (uint64_t*) malloc(sizeof(uint64_t) * sase_trace_size);
+  sase_rds              = (uint64_t*) malloc(sizeof(uint64_t) * sase_trace_size);
+  sase_donated          = (uint8_t*)  malloc(sizeof(uint8_t)  * sase_trace_size);
+  sase_pending_nodes    = (uint64_t*) malloc(sizeof(uint64_t) * sase_trace_size);
+
+  if (checkpoint_file_name != 0)
+    sase_decision_ptrs  = (uint64_t*) malloc(sizeof(uint64_t) * sase_trace_size);
+
+  tcs                   = (uint64_t*) malloc(sizeof(uint64_t) * sase_trace_size);
+  vaddrs                = (uint64_t*) malloc(sizeof(uint64_t) * sase_trace_size);
+  values                = (uint64_t*) malloc(sizeof(uint64_t) * sase_trace_size);
+  is_symbolics          = (uint8_t*)  malloc(sizeof(uint8_t)  * sase_trace_size);
+  symbolic_values       = (uint64_t*) malloc(sizeof(uint64_t) * sase_trace_size);
+
+  concrete_reads        = (uint64_t*) malloc(sizeof(uint64_t) * sase_trace_size);
+  constrained_reads     = (uint64_t*) malloc(sizeof(uint64_t) * sase_trace_size);
+
+  constrained_inputs    = (uint64_t*) malloc(sizeof(uint64_t) * sase_trace_size);
+  sase_input_trace_ptrs = (uint64_t*) malloc(sizeof(uint64_t) * sase_trace_size);
+
+  site_results   = zalloc(NUMBER_OF_QUERY_SITES * 3 * sizeof(uint64_t));
+  site_times     = zalloc(NUMBER_OF_QUERY_SITES * sizeof(uint64_t));
+  site_max_times = zalloc(NUMBER_OF_QUERY_SITES * sizeof(uint64_t));
+  site_latencies = zalloc(NUMBER_OF_QUERY_SITES * LATENCY_BUCKETS * sizeof(uint64_t));
+
+  queries_per_instruction    = zalloc(MAX_CODE_LENGTH / INSTRUCTIONSIZE * sizeof(uint64_t));
+  unsat_per_instruction      = zalloc(MAX_CODE_LENGTH / INSTRUCTIONSIZE * sizeof(uint64_t));
+  unknown_per_instruction    = zalloc(MAX_CODE_LENGTH / INSTRUCTIONSIZE * sizeof(uint64_t));
+  query_time_per_instruction = zalloc(MAX_CODE_LENGTH / INSTRUCTIONSIZE * sizeof(uint64_t));
+
+  if (jobs > 1)
+    init_jobs();
+  else
+    coverage = (uint8_t*) zalloc(MAX_CODE_LENGTH / INSTRUCTIONSIZE);
+
+  if (search != SEARCH_DFS)
+    init_search();
+
+  if (use_summaries)
+    init_summaries();
+
+  // initialization
+  *tcs             = 0;
+  *vaddrs          = 0;
+  *is_symbolics    = CONCRETE_T;
+  *symbolic_values = 0;
+}
+
+uint64_t is_trace_space_available() {
+  return tc + 1 < sase_trace_size;
+}
+
+void store_registers_fp_sp_rd() {
+  if (tc + 2 >= sase_trace_size)
+    throw_exception(EXCEPTION_MAXTRACE, 0);
+
+  tc++;
+  *(tcs             + tc) = 0;
+  *(is_symbolics    + tc) = 0;
+  *(values          + tc) = *(registers + REG_FP);
+  *(symbolic_values + tc) = sase_regs[REG_FP];
+  *(vaddrs + tc)          = rd;
+
+  tc++;
+  *(tcs             + tc) = 0;
+  *(is_symbolics    + tc) = 0;
+  *(values          + tc) = *(registers + REG_SP);
+  *(symbolic_values + tc) = sase_regs[REG_SP];
+  *(vaddrs + tc)          = rd;
+}
+
+void restore_registers_fp_sp_rd(uint64_t tr_cnt, uint64_t rd_reg) {
+  registers[REG_SP]     = *(values + tr_cnt);
+  sase_regs[REG_SP]     = *(symbolic_values + tr_cnt);
+  sase_regs_typ[REG_SP] = CONCRETE_T;
+  tr_cnt--;
+  tc--;
+  registers[REG_FP]     = *(values + tr_cnt);
+  sase_regs[REG_FP]     = *(symbolic_values + tr_cnt);
+  sase_regs_typ[REG_FP] = CONCRETE_T;
+
+  registers[rd_reg] = 0;
+  sase_regs[rd_reg] = zero_bv;
+  sase_regs_typ[rd_reg] = CONCRETE_T;
+}
+
+uint8_t check_next_1_instrs() {
+  uint64_t op;
+
+  pc = pc + INSTRUCTIONSIZE;
+  fetch();
+  pc = pc - INSTRUCTIONSIZE;
+  op = get_opcode(ir);
+  if (op == OP_BRANCH)
+    return 1;
+  else
+    return 0;
+}
+
+uint8_t match_sub(uint64_t prev_instr_rd) {
+  uint64_t rs1_;
+  uint64_t rs2_;
+  uint64_t rd_;
+  uint64_t funct3_;
+  uint64_t funct7_;
+
+  funct7_ = get_funct7(ir);
+  funct3_ = get_funct3(ir);
+  rs1_    = get_rs1(ir);
+  rs2_    = get_rs2(ir);
+  rd_     = get_rd(ir);
+
+  if (funct3_ == F3_ADD) {
+    if (funct7_ == F7_SUB)
+      if (rs1_ == prev_instr_rd)
+        if (rs2_ == rd)
+          if (rd_ == rs2_)
+            return 1;
+  }
+
+  return 0;
+}
+
+uint8_t match_addi() {
+  uint64_t rs1_;
+  uint64_t rd_;
+  uint64_t funct3_;
+  uint64_t imm_;
+
+  rs1_    = get_rs1(ir);
+  rd_     = get_rd(ir);
+  funct3_ = get_funct3(ir);
+  imm_    = get_immediate_i_format(ir);
+
+  if (funct3_ == F3_ADDI) {
+    if (imm_ == 1)
+      if (rs1_ == REG_ZR)
+        if (rd_ != rd)
+          return 1;
+  }
+
+  return 0;
+}
+
+uint8_t check_next_3_instrs() {
+  uint64_t rd_;
+  uint64_t opcode_;
+  uint64_t saved_pc;
+
+  saved_pc = pc;
+
+  pc = saved_pc + INSTRUCTIONSIZE;
+  fetch();
+  opcode_ = get_opcode(ir);
+  if (opcode_ == OP_IMM) {
+    if (match_addi()) {
+      rd_ = get_rd(ir);
+      pc = saved_pc + 2 * INSTRUCTIONSIZE;
+      fetch();
+      opcode_ = get_opcode(ir);
+      if (opcode_ == OP_OP) {
+        if (match_sub(rd_)) {
+          rd = get_rd(ir);
+          pc = saved_pc;
+          return 2;
+        }
+      }
+    }
+  }
+
+  pc = saved_pc;
+  return 1;
+}
+
+// ********************** engine instructions ************************
+
+// concrete values have no term until they meet a symbolic operand
+uint64_t sase_term(uint64_t reg) {
+  if (sase_regs_typ[reg] == SYMBOLIC_T)
+    return sase_regs[reg];
+  else
+    return bv_const(*(registers + reg));
+}
+
+void sase_lui() {
+  if (rd != REG_ZR)
+    sase_regs_typ[rd] = CONCRETE_T;
+}
+
+void sase_addi() {
+  if (rd != REG_ZR) {
+    if (sase_regs_typ[rs1] == SYMBOLIC_T)
+      sase_regs[rd] = bv_add(sase_regs[rs1], bv_const(imm));
+
+    sase_regs_typ[rd] = sase_regs_typ[rs1];
+  }
+}
+
+void sase_add() {
+  if (rd != REG_ZR) {
+    if (sase_regs_typ[rs1] == SYMBOLIC_T || sase_regs_typ[rs2] == SYMBOLIC_T)
+      sase_regs[rd] = bv_add(sase_term(rs1), sase_term(rs2));
+
+    sase_regs_typ[rd] = sase_regs_typ[rs1] | sase_regs_typ[rs2];
+  }
+}
+
+void sase_sub() {
+  if (rd != REG_ZR) {
+    if (sase_regs_typ[rs1] == SYMBOLIC_T || sase_regs_typ[rs2] == SYMBOLIC_T)
+      sase_regs[rd] = bv_sub(sase_term(rs1), sase_term(rs2));
+
+    sase_regs_typ[rd] = sase_regs_typ[rs1] | sase_regs_typ[rs2];
+  }
+}
+
+void sase_mul() {
+  if (rd != REG_ZR) {
+    if (sase_regs_typ[rs1] == SYMBOLIC_T || sase_regs_typ[rs2] == SYMBOLIC_T)
+      sase_regs[rd] = bv_mul(sase_term(rs1), sase_term(rs2));
+
+    sase_regs_typ[rd] = sase_regs_typ[rs1] | sase_regs_typ[rs2];
+  }
+}
+
+// writes the inputs and reads of the current path as one test vector:
+// their numbers followed by their values, all as 64-bit words. a path
+// reaching its end needs a check for its model, failing assertions
+// and divisions by zero come with the model of their check
+void sase_emit_test(uint64_t needs_check) {
+  uint64_t* vector;
+  uint64_t  i;
+
+  if (test_file == 0)
+    return;
+
+  if (needs_check)
+    if (sase_check(QUERY_TEST, pc) != SOLVER_SAT)
+      return;
+
+  vector = (uint64_t*) malloc(sizeof(uint64_t) * (2 + input_cnt_current + read_tc_current));
+
+  vector[0] = input_cnt_current;
+  vector[1] = read_tc_current;
+
+  i = 0;
+
+  while (i < input_cnt_current) {
+    vector[2 + i] = solver_get_value(constrained_inputs[i]);
+
+    i = i + 1;
+  }
+
+  i = 0;
+
+  while (i < read_tc_current) {
+    vector[2 + input_cnt_current + i] = solver_get_value(constrained_reads[i]);
+
+    i = i + 1;
+  }
+
+  fwrite(vector, sizeof(uint64_t), 2 + input_cnt_current + read_tc_current, test_file);
+
+  free(vector);
+
+  number_of_tests = number_of_tests + 1;
+}
+
+void sase_check_division_by_zero(uint64_t site) {
+  // a concrete non-zero divisor needs no check
+  if (sase_regs_typ[rs2] == CONCRETE_T)
+    if (*(registers + rs2) != 0)
+      return;
+
+  // recorded paths would hide the division by zero from later calls
+  if (current_activation != 0)
+    poison_summaries(current_activation);
+
+  solver_push();
+  solver_assert(bv_eq(sase_term(rs2), zero_bv));
+
+  // an unknown check reports nothing since there is no model to show
+  if (sase_check(site, pc) == SOLVER_SAT) {
+    printf("OUTPUT: SE division by zero! at pc %llx \n", pc - entry_point);
+    printf("backtracking: %llu \n", b);
+    sase_emit_test(0);
+    solver_print_model();
+    exit_explorer(EXITCODE_SYMBOLICEXECUTIONERROR);
+  }
+  solver_pop();
+}
+
+void sase_divu() {
+  sase_check_division_by_zero(QUERY_DIVU);
+
+  // divu semantics
+  if (rd != REG_ZR) {
+    if (sase_regs_typ[rs1] == SYMBOLIC_T || sase_regs_typ[rs2] == SYMBOLIC_T)
+      sase_regs[rd] = bv_udiv(sase_term(rs1), sase_term(rs2));
+
+    sase_regs_typ[rd] = sase_regs_typ[rs1] | sase_regs_typ[rs2];
+  }
+}
+
+void sase_remu() {
+  sase_check_division_by_zero(QUERY_REMU);
+
+  // remu semantics
+  if (rd != REG_ZR) {
+    if (sase_regs_typ[rs1] == SYMBOLIC_T || sase_regs_typ[rs2] == SYMBOLIC_T)
+      sase_regs[rd] = bv_urem(sase_term(rs1), sase_term(rs2));
+
+    sase_regs_typ[rd] = sase_regs_typ[rs1] | sase_regs_typ[rs2];
+  }
+}
+
+void sase_sltu() {
+  uint8_t  is_branch;
+  uint64_t op;
+  uint64_t saved_pc;
+  uint64_t result;
+  uint64_t condition;
+
+  ic_sltu = ic_sltu + 1;
+
+  if (rd != REG_ZR) {
+    which_branch = 0;
+
+    saved_pc = pc;
+
+    // concrete semantics
+    if (sase_regs_typ[rs1] == CONCRETE_T && sase_regs_typ[rs2] == CONCRETE_T) {
+      if (*(registers + rs1) < *(registers + rs2)) {
+        *(registers + rd) = 1;
+        sase_regs[rd]     = one_bv;
+      } else {
+        *(registers + rd) = 0;
+        sase_regs[rd]     = zero_bv;
+      }
+
+      which_branch = 1;
+
+      sase_regs_typ[rd] = CONCRETE_T;
+      pc = pc + INSTRUCTIONSIZE;
+      return;
+    }
+
+    // intervals of the operands do not overlap: only one branch is
+    // feasible which is taken like a concrete one
+    if (use_intervals)
+      if (decide_ult(sase_term(rs1), sase_term(rs2), &result)) {
+        sltu_by_interval = sltu_by_interval + 1;
+
+        // the decision depends on the path, so summaries record it
+        if (current_activation != 0) {
+          if (result)
+            summary_log_decision(bv_ult(sase_term(rs1), sase_term(rs2)));
+          else
+            summary_log_decision(bv_uge(sase_term(rs1), sase_term(rs2)));
+        }
+
+        *(registers + rd) = result;
+        if (result)
+          sase_regs[rd] = one_bv;
+        else
+          sase_regs[rd] = zero_bv;
+
+        which_branch = 1;
+
+        sase_regs_typ[rd] = CONCRETE_T;
+        pc = pc + INSTRUCTIONSIZE;
+        return;
+      }
+
+    is_branch = check_next_1_instrs();
+    if (is_branch == 0)
+      is_branch = check_next_3_instrs();
+
+    if (merge_regions)
+      if (assert_zone == 0)
+        if (sase_merge(is_branch))
+          return;
+
+    if (is_branch == 2) {
+      sase_false_branchs[sase_tc]    = bv_ult(sase_term(rs1), sase_term(rs2));
+      sase_pcs[sase_tc]              = pc  + 3 * INSTRUCTIONSIZE;
+
+      condition = bv_uge(sase_term(rs1), sase_term(rs2));
+
+      solver_push();
+      solver_assert(condition);
+
+      // skip execution of next two instructions
+      pc = pc + 3 * INSTRUCTIONSIZE;
+      ic_addi = ic_addi + 1;
+      ic_sub  = ic_sub  + 1;
+    }
+
+    if (is_branch == 1) {
+      sase_false_branchs[sase_tc]    = bv_uge(sase_term(rs1), sase_term(rs2));
+      sase_pcs[sase_tc]              = pc  + INSTRUCTIONSIZE;
+
+      condition = bv_ult(sase_term(rs1), sase_term(rs2));
+
+      solver_push();
+      solver_assert(condition);
+
+      pc = pc + INSTRUCTIONSIZE;
+    }
+
+    if (assert_zone == 0) {
+      // symbolic semantics
+      sase_open_level(0, 0);
+
+      if (current_activation != 0)
+        summary_log_decision(condition);
+
+      if (checkpoint_file_name != 0) {
+        sase_decision_ptrs[sase_tc - 1] = path_branches.size();
+
+        path_branches.push_back(saved_pc - entry_point);
+        path_decisions.push_back(1);
+      }
+
+      if (prefix_position < prefix_length) {
+        sase_replay_prefix(saved_pc);
+
+        return;
+      }
+
+      if (search != SEARCH_DFS) {
+        sase_search_sltu(saved_pc);
+
+        return;
+      }
+
+      if (lazy_checks) {
+        sase_regs[rd]     = one_bv;
+        sase_regs_typ[rd] = CONCRETE_T;
+        *(registers + rd) = 1;
+
+        sase_defer_check(saved_pc);
+
+        return;
+      }
+
+      sltu_by_solver = sltu_by_solver + 1;
+
+      result = sase_check(QUERY_SLTU, saved_pc);
+
+      if (is_feasible(result)) {
+        sase_regs[rd]     = one_bv;
+        sase_regs_typ[rd] = CONCRETE_T;
+        *(registers + rd) = 1;
+      } else {
+        // printf("%s\n", "unreachable branch true!");
+        if (result == SOLVER_UNKNOWN)
+          if (current_activation != 0)
+            poison_summaries(current_activation);
+
+        if (result == SOLVER_UNSAT)
+          if (sase_backjump()) {
+            sase_backtrack_sltu(0);
+
+            return;
+          }
+
+        sase_backtrack_sltu(result == SOLVER_UNSAT);
+      }
+    } else {
+      solver_pop();
+    }
+
+  } else
+    pc = pc + INSTRUCTIONSIZE;
+}
+
+uint64_t latency_bucket(uint64_t microseconds) {
+  uint64_t i = 0;
+
+  while (i < LATENCY_BUCKETS - 1) {
+    if (microseconds < (1ULL << i))
+      return i;
+
+    i = i + 1;
+  }
+
+  return i;
+}
+
+void record_query(uint64_t site, uint64_t at, uint64_t result) {
+  uint64_t t;
+  uint64_t a;
+
+  t = last_check_microseconds;
+
+  site_results[site * 3 + result] = site_results[site * 3 + result] + 1;
+  site_times[site]                = site_times[site] + t;
+
+  if (t > site_max_times[site])
+    site_max_times[site] = t;
+
+  site_latencies[site * LATENCY_BUCKETS + latency_bucket(t)] = site_latencies[site * LATENCY_BUCKETS + latency_bucket(t)] + 1;
+
+  a = (at - entry_point) / INSTRUCTIONSIZE;
+
+  query_time = query_time + t;
+
+  queries_per_instruction[a]    = queries_per_instruction[a] + 1;
+  query_time_per_instruction[a] = query_time_per_instruction[a] + t;
+
+  if (result == SOLVER_UNSAT) {
+    number_of_unsat_queries  = number_of_unsat_queries + 1;
+    unsat_per_instruction[a] = unsat_per_instruction[a] + 1;
+  } else if (result == SOLVER_UNKNOWN)
+    unknown_per_instruction[a] = unknown_per_instruction[a] + 1;
+}
+
+uint64_t sase_check(uint64_t site, uint64_t at) {
+  uint64_t result;
+
+  result = solver_check();
+
+  record_query(site, at, result);
+
+  return result;
+}
+
+uint64_t sase_check_prefix(uint64_t site, uint64_t at, uint64_t length) {
+  uint64_t result;
+
+  result = solver_check_prefix(length);
+
+  record_query(site, at, result);
+
+  return result;
+}
+
+// upper bound of the p-th percentile of the latencies of site
+uint64_t latency_percentile(uint64_t site, uint64_t p) {
+  uint64_t total = site_results[site * 3] + site_results[site * 3 + 1] + site_results[site * 3 + 2];
+  uint64_t count = 0;
+  uint64_t i     = 0;
+
+  while (i < LATENCY_BUCKETS) {
+    count = count + site_latencies[site * LATENCY_BUCKETS + i];
+
+    if (count * 100 >= total * p) {
+      // the maximum is a tighter bound for the slowest bucket
+      if ((1ULL << i) - 1 > site_max_times[site])
+        return site_max_times[site];
+      else
+        return (1ULL << i) - 1;
+    }
+
+    i = i + 1;
+  }
+
+  return site_max_times[site];
+}
+
+uint64_t is_feasible(uint64_t result) {
+  if (result == SOLVER_UNKNOWN)
+    return explore_unknown;
+  else
+    return result == SOLVER_SAT;
+}
+
+// if the unsat core of the most recent check does not contain the
+// latest branch decision, the path prefix itself is infeasible and so
+// is the false branch of every trace level whose prefix still contains
+// the core. these levels are dropped without checking them and their
+// stores are undone at once by the next backtrack
+uint64_t sase_backjump() {
+  return sase_backjump_to(solver_core_bound());
+}
+
+// drops all trace levels opened after the constraint at position bound
+uint64_t sase_backjump_to(uint64_t bound) {
+  uint64_t level = sase_tc;
+
+  while (level > sase_base) {
+    if (asserted_scopes[level - 1] > bound)
+      level = level - 1;
+    else
+      break;
+  }
+
+  if (level == sase_tc)
+    return 0;
+
+  number_of_backjumps = number_of_backjumps + 1;
+  skipped_levels      = skipped_levels + sase_tc - level;
+
+  sase_drop_levels(level);
+
+  return 1;
+}
+
+// drops all trace levels from level on without exploring their
+// false branches, their stores are undone by the next backtrack
+void sase_drop_levels(uint64_t level) {
+  mrif    = sase_store_trace_ptrs[level];
+  sase_tc = level;
+
+  while (asserted_scopes.size() > sase_tc)
+    solver_pop();
+}
+
+// opens a trace level for the branch whose false branch and address
+// are set already. path + 1 of the summary is tried at the call when
+// the level is backtracked, both are 0 for branches of the code
+void sase_open_level(uint64_t summary, uint64_t path) {
+  sase_program_brks[sase_tc]     = get_program_break(current_context);
+  sase_read_trace_ptrs[sase_tc]  = read_tc_current;
+  sase_input_trace_ptrs[sase_tc] = input_cnt_current;
+  sase_store_trace_ptrs[sase_tc] = mrif;
+  sase_donated[sase_tc]          = 0;
+
+  if (use_summaries) {
+    sase_activations[sase_tc]       = current_activation;
+    sase_activation_counts[sase_tc] = activation_parents.size();
+    sase_summary_logs[sase_tc]      = summary_log.size();
+    sase_summary_ids[sase_tc]       = summary;
+    sase_summary_nexts[sase_tc]     = path;
+  }
+
+  mrif = tc;
+  store_registers_fp_sp_rd(); // after mrif =
+  sase_tc++;
+}
+
+// closes the topmost trace level and restores the machine state at
+// its branch, the false branch is neither asserted nor taken yet
+void sase_restore_level() {
+  sase_tc--;
+  pc                = sase_pcs[sase_tc];
+  read_tc_current   = sase_read_trace_ptrs[sase_tc];
+  input_cnt_current = sase_input_trace_ptrs[sase_tc];
+  set_program_break(current_context, sase_program_brks[sase_tc]);
+  backtrack_branch_stores(); // before mrif =
+  mrif = sase_store_trace_ptrs[sase_tc];
+
+  solver_pop();
+
+  if (feasible_length > asserted.size())
+    feasible_length = asserted.size();
+
+  if (use_summaries)
+    restore_summaries();
+
+  // the path continues with the false branch of the level
+  if (checkpoint_file_name != 0) {
+    path_branches.resize(sase_decision_ptrs[sase_tc] + 1);
+    path_decisions.resize(sase_decision_ptrs[sase_tc] + 1);
+
+    path_decisions[sase_decision_ptrs[sase_tc]] = 0;
+  }
+}
+
+void sase_backtrack_sltu(int is_true_branch_unreachable) {
+  uint64_t result;
+
+  if (sase_tc == sase_base) {
+    // printf("pc: %llx, read_tc: %llu, arg: %d\n", pc - entry_point, read_tc, is_true_branch_unreachable);
+    pc = 0;
+    return;
+  }
+
+  sase_restore_level();
+
+  if (sase_donated[sase_tc]) {
+    sase_backtrack_sltu(0);
+
+    return;
+  }
+
+  solver_assert(sase_false_branchs[sase_tc]);
+
+  if (current_activation != 0)
+    summary_log_decision(sase_false_branchs[sase_tc]);
+
+  if (lazy_checks) {
+    sase_regs[rd]     = zero_bv;
+    sase_regs_typ[rd] = CONCRETE_T;
+    *(registers + rd) = 0;
+
+    sase_defer_check(pc);
+
+    return;
+  }
+
+  result = sase_check(QUERY_BACKTRACK, pc);
+
+  if (is_feasible(result) == 0) {
+    // both branches are only contradictory if neither is unknown
+    if (is_true_branch_unreachable && result == SOLVER_UNSAT) {
+      printf("%s\n", "unreachable branch both true and false!");
+      exit_explorer(EXITCODE_SYMBOLICEXECUTIONERROR);
+    } else {
+      // printf("%s %llu\n", "unreachable branch false!", pc);
+      if (result == SOLVER_UNKNOWN)
+        if (current_activation != 0)
+          poison_summaries(current_activation);
+
+      if (result == SOLVER_UNSAT)
+        sase_backjump();
+
+      sase_backtrack_sltu(0);
+    }
+  } else {
+    sase_regs[rd]     = zero_bv;
+    sase_regs_typ[rd] = CONCRETE_T;
+    *(registers + rd) = 0;
+
+    // every path to the left of the false branch is explored
+    if (checkpoint_file_name != 0)
+      if (wall_clock_milliseconds() >= next_checkpoint) {
+        save_exploration();
+
+        next_checkpoint = wall_clock_milliseconds() + checkpoint_interval * 1000;
+      }
+  }
+}
+
+// takes the latest branch decision without a check. the decisions
+// are checked together once lazy_checks of them are pending
+void sase_defer_check(uint64_t at) {
+  deferred_branches = deferred_branches + 1;
+  pending_branches  = pending_branches + 1;
+
+  if (pending_branches >= lazy_checks)
+    sase_checkpoint(at);
+}
+
+// checks all pending branch decisions of the path at once. if the
+// path is infeasible, the first infeasible constraint is found by
+// bisection over the path prefixes and the path is backtracked to
+// the decision which asserted it. returns 0 if it has backtracked
+uint64_t sase_checkpoint(uint64_t at) {
+  uint64_t result;
+  uint64_t lo;
+  uint64_t hi;
+  uint64_t mid;
+
+  if (pending_branches == 0)
+    return 1;
+
+  pending_branches = 0;
+
+  number_of_checkpoints = number_of_checkpoints + 1;
+
+  result = sase_check(QUERY_CHECKPOINT, at);
+
+  if (is_feasible(result)) {
+    feasible_length = asserted.size();
+
+    return 1;
+  }
+
+  infeasible_checkpoints = infeasible_checkpoints + 1;
+
+  // the prefix of length lo is feasible, the one of length hi is not
+  lo = feasible_length;
+  hi = asserted.size();
+
+  // no constraint after the unsat core is needed for the conflict
+  if (result == SOLVER_UNSAT) {
+    mid = solver_core_bound() + 1;
+
+    if (mid > lo)
+      hi = mid;
+  }
+
+  if (lo >= hi)
+    lo = 0;
+
+  while (lo + 1 < hi) {
+    mid = lo + (hi - lo) / 2;
+
+    if (is_feasible(sase_check_prefix(QUERY_BISECT, at, mid)))
+      lo = mid;
+    else
+      hi = mid;
+  }
+
+  feasible_length = lo;
+
+  sase_backjump_to(hi - 1);
+  sase_backtrack_sltu(0);
+
+  return 0;
+}
+
+// with -search other than dfs, every symbolic branch decision adds
+// two nodes to the path tree. the node of the branch not taken joins
+// the frontier of pending branches from which the strategy selects
+// the next path once the current one ends:
+//
+// bfs          the oldest pending branch
+// random-path  a pending branch at depth d with a chance proportional
+//              to 2^-d, so that shallow subtrees are not starved by
+//              deep ones
+// coverage-new the most recent pending branch whose first instruction
+//              has not been executed yet, otherwise the most recent one
+// iddfs        the most recent pending branch within the depth bound.
+//              paths are cut at the bound and both of their branches
+//              wait until the bound is doubled
+//
+// a pending branch whose trace level is still open is taken by
+// backtracking to the level like dfs does. any other is taken by
+// executing the program again from its start, forcing the decisions
+// on the path to the branch without checks but the last one. the
+// trace is not kept for closed levels, so re-execution trades time
+// for the memory of a copy of the state of every pending branch
+
+void init_search() {
+  number_of_nodes = 0;
+
+  new_node(0, 0, 0, 0); // the root
+}
+
+uint64_t new_node(uint64_t parent, uint8_t decision, uint64_t at, uint64_t branch) {
+  uint64_t n;
+
+  if (number_of_nodes == max_number_of_nodes) {
+    max_number_of_nodes = 2 * max_number_of_nodes + 1024;
+
+    node_parents   = (uint64_t*) realloc(node_parents,   sizeof(uint64_t) * max_number_of_nodes);
+    node_pcs       = (uint64_t*) realloc(node_pcs,       sizeof(uint64_t) * max_number_of_nodes);
+    node_depths    = (uint64_t*) realloc(node_depths,    sizeof(uint64_t) * max_number_of_nodes);
+    node_decisions = (uint8_t*)  realloc(node_decisions, sizeof(uint8_t)  * max_number_of_nodes);
+    node_branches  = (uint64_t*) realloc(node_branches,  sizeof(uint64_t) * max_number_of_nodes);
+    node_inputs    = (uint64_t*) realloc(node_inputs,    sizeof(uint64_t) * max_number_of_nodes);
+    node_reads     = (uint64_t*) realloc(node_reads,     sizeof(uint64_t) * max_number_of_nodes);
+  }
+
+  n = number_of_nodes;
+
+  node_parents[n]   = parent;
+  node_pcs[n]       = at;
+  node_decisions[n] = decision;
+  node_branches[n]  = branch;
+  node_inputs[n]    = input_cnt_current;
+  node_reads[n]     = read_tc_current;
+
+  if (n == 0)
+    node_depths[n] = 0;
+  else
+    node_depths[n] = node_depths[parent] + 1;
+
+  number_of_nodes = number_of_nodes + 1;
+
+  return n;
+}
+
+// the false branch continues at the target of the beq at address at
+uint64_t branch_target(uint64_t at) {
+  uint64_t saved_pc;
+
+  saved_pc = pc;
+
+  pc = at;
+  fetch();
+  pc = saved_pc;
+
+  return at + get_immediate_b_format(ir);
+}
+
+uint64_t next_random() {
+  random_state = random_state * 6364136223846793005ULL + 1442695040888963407ULL;
+
+  return random_state >> 11;
+}
+
+// index of the pending node selected by the strategy
+uint64_t select_pending() {
+  uint64_t i;
+  uint64_t min_depth;
+  double   total;
+  double   r;
+
+  if (search == SEARCH_BFS)
+    return 0;
+  else if (search == SEARCH_RANDOM_PATH) {
+    min_depth = node_depths[frontier[0]];
+
+    i = 1;
+
+    while (i < frontier.size()) {
+      if (node_depths[frontier[i]] < min_depth)
+        min_depth = node_depths[frontier[i]];
+
+      i = i + 1;
+    }
+
+    total = 0;
+
+    i = 0;
+
+    while (i < frontier.size()) {
+      total = total + ldexp(1.0, - (int) (node_depths[frontier[i]] - min_depth));
+
+      i = i + 1;
+    }
+
+    // 53 random bits scaled to [0, total)
+    r = ldexp((double) next_random(), -53) * total;
+
+    i = 0;
+
+    while (i + 1 < frontier.size()) {
+      r = r - ldexp(1.0, - (int) (node_depths[frontier[i]] - min_depth));
+
+      if (r < 0)
+        return i;
+
+      i = i + 1;
+    }
+
+    return i;
+  } else if (search == SEARCH_COVERAGE_NEW) {
+    i = frontier.size();
+
+    while (i > 0) {
+      i = i - 1;
+
+      if (coverage[(node_pcs[frontier[i]] - entry_point) / INSTRUCTIONSIZE] == 0)
+        return i;
+    }
+
+    return frontier.size() - 1;
+  } else {
+    // iterative deepening
+    while (1) {
+      i = frontier.size();
+
+      while (i > 0) {
+        i = i - 1;
+
+        if (node_depths[frontier[i]] <= depth_bound)
+          return i;
+      }
+
+      depth_bound = 2 * depth_bound;
+    }
+  }
+}
+
+// keeps the state of the program after loading as root of all paths
+void sase_snapshot() {
+  uint64_t i;
+
+  root_registers     = (uint64_t*) malloc(sizeof(uint64_t) * NUMBEROFREGISTERS);
+  root_sase_regs     = (uint64_t*) malloc(sizeof(uint64_t) * NUMBEROFREGISTERS);
+  root_sase_regs_typ = (uint8_t*)  malloc(sizeof(uint8_t)  * NUMBEROFREGISTERS);
+
+  i = 0;
+
+  while (i < NUMBEROFREGISTERS) {
+    root_registers[i]     = registers[i];
+    root_sase_regs[i]     = sase_regs[i];
+    root_sase_regs_typ[i] = sase_regs_typ[i];
+
+    i = i + 1;
+  }
+
+  root_program_break = get_program_break(current_context);
+  root_pc            = pc;
+
+  // stores of the program must not overwrite the loaded memory
+  root_tc = tc;
+  mrif    = tc;
+}
+
+// executes the program again from its start towards node
+void sase_restart(uint64_t node) {
+  uint64_t i;
+
+  number_of_restarts = number_of_restarts + 1;
+
+  sase_tc = 0;
+
+  solver_reset();
+
+  mrif = root_tc;
+
+  backtrack_branch_stores();
+
+  i = 0;
+
+  while (i < NUMBEROFREGISTERS) {
+    registers[i]     = root_registers[i];
+    sase_regs[i]     = root_sase_regs[i];
+    sase_regs_typ[i] = root_sase_regs_typ[i];
+
+    i = i + 1;
+  }
+
+  set_program_break(current_context, root_program_break);
+
+  pc = root_pc;
+
+  read_tc_current   = 0;
+  input_cnt_current = 0;
+  pending_branches  = 0;
+  feasible_length   = 0;
+  which_branch      = 0;
+  assert_zone       = 0;
+
+  forced_nodes.resize(node_depths[node]);
+
+  i = node_depths[node];
+
+  while (node != 0) {
+    i = i - 1;
+
+    forced_nodes[i] = node;
+
+    node = node_parents[node];
+  }
+
+  forced_position = 0;
+  current_node    = 0;
+  prefix_position = 0;
+}
+
+// takes the false branch of the trace level just opened
+void sase_take_false_branch(uint64_t node, uint64_t needs_check) {
+  sase_restore_level();
+
+  solver_assert(sase_false_branchs[sase_tc]);
+
+  current_node = node;
+
+  if (needs_check)
+    if (is_feasible(sase_check(QUERY_BACKTRACK, pc)) == 0) {
+      sase_next_path();
+
+      return;
+    }
+
+  sase_regs[rd]     = zero_bv;
+  sase_regs_typ[rd] = CONCRETE_T;
+  *(registers + rd) = 0;
+}
+
+// the branch decision of the trace level just opened
+void sase_search_sltu(uint64_t at) {
+  uint64_t node;
+  uint64_t last;
+  uint64_t target;
+  uint64_t branch;
+
+  sase_pending_nodes[sase_tc - 1] = 0;
+
+  if (forced_position < forced_nodes.size()) {
+    node = forced_nodes[forced_position];
+
+    forced_position = forced_position + 1;
+
+    // the pending branch itself is checked, its prefix is known to be feasible
+    last = forced_position == forced_nodes.size();
+
+    if (node_decisions[node] == 0) {
+      sase_take_false_branch(node, last);
+
+      return;
+    }
+
+    current_node = node;
+
+    if (last) {
+      sltu_by_solver = sltu_by_solver + 1;
+
+      if (is_feasible(sase_check(QUERY_SLTU, at)) == 0) {
+        sase_next_path();
+
+        return;
+      }
+    }
+
+    sase_regs[rd]     = one_bv;
+    sase_regs_typ[rd] = CONCRETE_T;
+    *(registers + rd) = 1;
+
+    return;
+  }
+
+  target = branch_target(sase_pcs[sase_tc - 1]);
+  branch = at - entry_point;
+
+  if (search == SEARCH_IDDFS)
+    if (node_depths[current_node] >= depth_bound) {
+      frontier.push_back(new_node(current_node, 1, sase_pcs[sase_tc - 1] + INSTRUCTIONSIZE, branch));
+      frontier.push_back(new_node(current_node, 0, target, branch));
+
+      number_of_cut_paths = number_of_cut_paths + 1;
+
+      sase_next_path();
+
+      return;
+    }
+
+  if (split > 0)
+    if (frontier.size() + 2 > split) {
+      // the path so far is the last subtree, splitting it would exceed the number of prefixes
+      frontier.push_back(current_node);
+
+      pc   = 0;
+      trap = 1;
+
+      return;
+    }
+
+  sltu_by_solver = sltu_by_solver + 1;
+
+  if (is_feasible(sase_check(QUERY_SLTU, at))) {
+    if (split > 0) {
+      // -split cuts every path where both branches are feasible
+      if (is_false_branch_feasible(at)) {
+        frontier.push_back(new_node(current_node, 1, sase_pcs[sase_tc - 1] + INSTRUCTIONSIZE, branch));
+        frontier.push_back(new_node(current_node, 0, target, branch));
+
+        number_of_cut_paths = number_of_cut_paths + 1;
+
+        sase_next_path();
+
+        return;
+      }
+    } else {
+      node = new_node(current_node, 0, target, branch);
+
+      frontier.push_back(node);
+
+      sase_pending_nodes[sase_tc - 1] = node;
+    }
+
+    current_node = new_node(current_node, 1, sase_pcs[sase_tc - 1] + INSTRUCTIONSIZE, branch);
+
+    sase_regs[rd]     = one_bv;
+    sase_regs_typ[rd] = CONCRETE_T;
+    *(registers + rd) = 1;
+  } else
+    sase_take_false_branch(new_node(current_node, 0, target, branch), 1);
+}
+
+// checks the false branch of the trace level just opened, its true
+// branch is asserted again afterwards
+uint64_t is_false_branch_feasible(uint64_t at) {
+  uint64_t t;
+  uint64_t result;
+
+  t = asserted.back();
+
+  solver_pop();
+  solver_push();
+  solver_assert(sase_false_branchs[sase_tc - 1]);
+
+  result = sase_check(QUERY_BACKTRACK, at);
+
+  solver_pop();
+  solver_push();
+  solver_assert(t);
+
+  return is_feasible(result);
+}
+
+// continues with the pending branch selected by the strategy. sets
+// pc to 0 and ends the current instruction if there is none left
+void sase_next_path() {
+  uint64_t i;
+  uint64_t node;
+  uint64_t level;
+
+  while (frontier.size() > 0) {
+    i = select_pending();
+
+    node = frontier[i];
+
+    frontier.erase(frontier.begin() + i);
+
+    level = sase_tc;
+
+    while (level > 0) {
+      level = level - 1;
+
+      if (sase_pending_nodes[level] == node)
+        break;
+    }
+
+    if (sase_tc > 0)
+      if (sase_pending_nodes[level] == node) {
+        number_of_resumes = number_of_resumes + 1;
+
+        if (level + 1 < sase_tc)
+          sase_drop_levels(level + 1);
+
+        sase_pending_nodes[level] = 0;
+
+        sase_take_false_branch(node, 0);
+
+        if (is_feasible(sase_check(QUERY_BACKTRACK, pc)))
+          return;
+        else
+          continue;
+      }
+
+    sase_restart(node);
+
+    return;
+  }
+
+  pc   = 0;
+  trap = 1;
+}
+
+// a path prefix is written as text: a header with the number of
+// branch decisions and the input and read counters at the last one,
+// then every decision as the address of its sltu relative to the
+// entry point and 1 for the true or 0 for the false branch:
+//
+// prefix 2 1 0
+// 3c 1
+// 58 0
+//
+// -prefix replays the decisions without checks, only the last one
+// is checked, and explores the subtree beneath it. symbolic branches
+// decided by intervals are no decisions, so the prefix needs the same
+// -no-intervals option as the run that wrote it
+
+void read_prefix() {
+  FILE*    file;
+  uint64_t i;
+  unsigned long long branch;
+  unsigned long long decision;
+  unsigned long long length;
+  unsigned long long inputs;
+  unsigned long long reads;
+
+  file = fopen(prefix_file_name, "r");
+
+  if (file == 0) {
+    printf("cannot read prefix %s\n", prefix_file_name);
+
+    exit_explorer(EXITCODE_IOERROR);
+  }
+
+  if (fscanf(file, "prefix %llu %llu %llu", &length, &inputs, &reads) != 3) {
+    printf("%s is no prefix\n", prefix_file_name);
+
+    exit_explorer(EXITCODE_IOERROR);
+  }
+
+  prefix_length = length;
+  prefix_inputs = inputs;
+  prefix_reads  = reads;
+
+  prefix_branches  = (uint64_t*) malloc(sizeof(uint64_t) * (prefix_length + 1));
+  prefix_decisions = (uint8_t*)  malloc(sizeof(uint8_t)  * (prefix_length + 1));
+
+  i = 0;
+
+  while (i < prefix_length) {
+    if (fscanf(file, "%llx %llu", &branch, &decision) != 2) {
+      printf("prefix %s ends after %llu decisions\n", prefix_file_name, (unsigned long long) i);
+
+      exit_explorer(EXITCODE_IOERROR);
+    }
+
+    prefix_branches[i]  = branch;
+    prefix_decisions[i] = decision != 0;
+
+    i = i + 1;
+  }
+
+  fclose(file);
+}
+
+// takes the next decision of the prefix on the trace level just opened
+void sase_replay_prefix(uint64_t at) {
+  if (prefix_branches[prefix_position] != at - entry_point) {
+    printf("prefix %s does not match the program at decision %llu\n", prefix_file_name, (unsigned long long) prefix_position);
+
+    exit_explorer(EXITCODE_BADARGUMENTS);
+  }
+
+  prefix_position = prefix_position + 1;
+
+  sase_pending_nodes[sase_tc - 1] = 0;
+
+  if (prefix_position == prefix_length)
+    if (input_cnt_current != prefix_inputs || read_tc_current != prefix_reads) {
+      printf("prefix %s does not match the inputs of the program\n", prefix_file_name);
+
+      exit_explorer(EXITCODE_BADARGUMENTS);
+    }
+
+  if (prefix_decisions[prefix_position - 1]) {
+    sase_regs[rd]     = one_bv;
+    sase_regs_typ[rd] = CONCRETE_T;
+    *(registers + rd) = 1;
+  } else {
+    sase_restore_level();
+
+    solver_assert(sase_false_branchs[sase_tc]);
+
+    sase_regs[rd]     = zero_bv;
+    sase_regs_typ[rd] = CONCRETE_T;
+    *(registers + rd) = 0;
+  }
+
+  if (prefix_position < prefix_length)
+    return;
+
+  // the open levels of a saved exploration are still to be
+  // backtracked, those of a prefix never are
+  if (resume_file_name == 0)
+    sase_base = sase_tc;
+
+  // restarts of the search replay the prefix again
+  if (prefix_checked)
+    return;
+
+  prefix_checked = 1;
+
+  sltu_by_solver = sltu_by_solver + 1;
+
+  if (is_feasible(sase_check(QUERY_SLTU, at)) == 0) {
+    printf("prefix %s is infeasible\n", prefix_file_name);
+
+    pc   = 0;
+    trap = 1;
+  } else
+    feasible_length = asserted.size();
+}
+
+// writes the path to node as prefix
+void write_prefix(uint64_t node, char* name) {
+  FILE*    file;
+  uint64_t i;
+  uint64_t n;
+
+  file = fopen(name, "w");
+
+  if (file == 0) {
+    printf("cannot write prefix %s\n", name);
+
+    exit_explorer(EXITCODE_IOERROR);
+  }
+
+  // a prefix which is split again is part of every prefix beneath
+  if (node == 0)
+    fprintf(file, "prefix %llu %llu %llu\n", (unsigned long long) prefix_length,
+      (unsigned long long) prefix_inputs, (unsigned long long) prefix_reads);
+  else
+    fprintf(file, "prefix %llu %llu %llu\n", (unsigned long long) (prefix_length + node_depths[node]),
+      (unsigned long long) node_inputs[node], (unsigned long long) node_reads[node]);
+
+  i = 0;
+
+  while (i < prefix_length) {
+    fprintf(file, "%llx %llu\n", (unsigned long long) prefix_branches[i], (unsigned long long) prefix_decisions[i]);
+
+    i = i + 1;
+  }
+
+  forced_nodes.resize(node_depths[node]);
+
+  i = node_depths[node];
+  n = node;
+
+  while (n != 0) {
+    i = i - 1;
+
+    forced_nodes[i] = n;
+
+    n = node_parents[n];
+  }
+
+  while (i < forced_nodes.size()) {
+    fprintf(file, "%llx %llu\n", (unsigned long long) node_branches[forced_nodes[i]], (unsigned long long) node_decisions[forced_nodes[i]]);
+
+    i = i + 1;
+  }
+
+  fclose(file);
+}
+
+// -split explores the path tree breadth-first and cuts every path
+// where both branches are feasible until the pending subtrees would
+// exceed the number of prefixes. paths which end before are explored
+// completely, the subtrees still pending are written as prefixes
+void write_prefixes() {
+  char     name[4096];
+  uint64_t i;
+
+  i = 0;
+
+  while (i < frontier.size()) {
+    snprintf(name, sizeof(name), "%s/prefix_%04llu", split_directory, (unsigned long long) i);
+
+    write_prefix(frontier[i], name);
+
+    i = i + 1;
+  }
+
+  printf("split: %llu prefixes written to %s\n", (unsigned long long) frontier.size(), split_directory);
+}
+
+// -checkpoint saves the exploration whenever a false branch is taken
+// after checkpoint_interval seconds. every path to the left of that
+// branch is explored, so the exploration is the current path and the
+// number of paths so far. the path is written like a prefix with a
+// different header which adds the number of paths:
+//
+// exploration 2 1 0 17
+// 3c 1
+// 58 0
+//
+// -resume replays the path like a prefix. the replay rebuilds memory,
+// the traces, the input and read variables and the constraints by
+// executing the same decisions again, and the search backtracks its
+// true decisions afterwards as if it had never stopped. the file is
+// replaced by renaming so that it is complete whenever the run stops
+
+void save_exploration() {
+  FILE*    file;
+  char     name[4096];
+  uint64_t i;
+
+  snprintf(name, sizeof(name), "%s.tmp", checkpoint_file_name);
+
+  file = fopen(name, "w");
+
+  if (file == 0) {
+    printf("cannot write checkpoint %s\n", name);
+
+    exit_explorer(EXITCODE_IOERROR);
+  }
+
+  fprintf(file, "exploration %llu %llu %llu %llu\n", (unsigned long long) path_branches.size(),
+    (unsigned long long) input_cnt_current, (unsigned long long) read_tc_current, (unsigned long long) b);
+
+  i = 0;
+
+  while (i < path_branches.size()) {
+    fprintf(file, "%llx %llu\n", (unsigned long long) path_branches[i], (unsigned long long) path_decisions[i]);
+
+    i = i + 1;
+  }
+
+  if (fclose(file) != 0 || rename(name, checkpoint_file_name) != 0) {
+    printf("cannot write checkpoint %s\n", checkpoint_file_name);
+
+    exit_explorer(EXITCODE_IOERROR);
+  }
+
+  number_of_saves = number_of_saves + 1;
+}
+
+void load_exploration() {
+  FILE*    file;
+  uint64_t i;
+  unsigned long long branch;
+  unsigned long long decision;
+  unsigned long long length;
+  unsigned long long inputs;
+  unsigned long long reads;
+  unsigned long long paths;
+
+  file = fopen(resume_file_name, "r");
+
+  if (file == 0) {
+    printf("cannot read checkpoint %s\n", resume_file_name);
+
+    exit_explorer(EXITCODE_IOERROR);
+  }
+
+  if (fscanf(file, "exploration %llu %llu %llu %llu", &length, &inputs, &reads, &paths) != 4) {
+    printf("%s is no checkpoint\n", resume_file_name);
+
+    exit_explorer(EXITCODE_IOERROR);
+  }
+
+  // the path is replayed as prefix which is named in its messages
+  prefix_file_name = resume_file_name;
+
+  prefix_length = length;
+  prefix_inputs = inputs;
+  prefix_reads  = reads;
+
+  prefix_branches  = (uint64_t*) malloc(sizeof(uint64_t) * (prefix_length + 1));
+  prefix_decisions = (uint8_t*)  malloc(sizeof(uint8_t)  * (prefix_length + 1));
+
+  i = 0;
+
+  while (i < prefix_length) {
+    if (fscanf(file, "%llx %llu", &branch, &decision) != 2) {
+      printf("checkpoint %s ends after %llu decisions\n", resume_file_name, (unsigned long long) i);
+
+      exit_explorer(EXITCODE_IOERROR);
+    }
+
+    prefix_branches[i]  = branch;
+    prefix_decisions[i] = decision != 0;
+
+    i = i + 1;
+  }
+
+  fclose(file);
+
+  b = paths;
+}
+
+// with -merge, the code segment is searched for short acyclic regions
+// behind a beq before exploration starts. there are two shapes:
+//
+// if        beq t, zero, join        if-else   beq t, zero, else
+//           ...true side                       ...true side
+//   join:                                      jal zero, join
+//                                      else:   ...false side
+//                                      join:
+//
+// both sides must consist of at most MAX_REGION_LENGTH instructions
+// among lui, addi, add, sub, mul, ld and sd. a symbolic branch of a
+// region is not forked. both sides are evaluated on copies of the
+// registers and of the stores instead, and their effects are merged
+// into if-then-else terms on the branch condition at the join point.
+// a side loading from or storing to a symbolic or unmapped address
+// aborts the merge, and the branch is forked as usual. merged
+// branches are no decisions, so -prefix needs the same -merge option
+// as the run that wrote the prefix
+
+uint64_t is_mergeable_instruction(uint64_t instruction) {
+  uint64_t op;
+  uint64_t f7;
+
+  op = get_opcode(instruction);
+
+  if (op == OP_LUI)
+    return 1;
+  else if (op == OP_IMM)
+    return get_funct3(instruction) == F3_ADDI;
+  else if (op == OP_LD)
+    return get_funct3(instruction) == F3_LD;
+  else if (op == OP_SD)
+    return get_funct3(instruction) == F3_SD;
+  else if (op == OP_OP)
+    if (get_funct3(instruction) == F3_ADD) {
+      f7 = get_funct7(instruction);
+
+      return f7 == F7_ADD || f7 == F7_SUB || f7 == F7_MUL;
+    }
+
+  return 0;
+}
+
+// from and to are offsets into the code segment, to is excluded
+uint64_t is_mergeable_region(uint64_t from, uint64_t to) {
+  if ((to - from) / INSTRUCTIONSIZE > MAX_REGION_LENGTH)
+    return 0;
+
+  while (from < to) {
+    if (is_mergeable_instruction(load_instruction(from)) == 0)
+      return 0;
+
+    from = from + INSTRUCTIONSIZE;
+  }
+
+  return 1;
+}
+
+// the join point of the beq at offset at, 0 if it starts no region
+uint64_t find_join_point(uint64_t at) {
+  uint64_t instruction;
+  uint64_t target;
+  uint64_t end;
+  uint64_t join;
+
+  instruction = load_instruction(at);
+
+  if (get_opcode(instruction) != OP_BRANCH)
+    return 0;
+
+  // backward branches close loops
+  if ((int64_t) get_immediate_b_format(instruction) <= 0)
+    return 0;
+
+  target = at + get_immediate_b_format(instruction);
+
+  end  = target;
+  join = target;
+
+  if (target - INSTRUCTIONSIZE > at) {
+    instruction = load_instruction(target - INSTRUCTIONSIZE);
+
+    if (get_opcode(instruction) == OP_JAL)
+      if (get_rd(instruction) == REG_ZR)
+        if ((int64_t) get_immediate_j_format(instruction) > 0) {
+          end  = target - INSTRUCTIONSIZE;
+          join = end + get_immediate_j_format(instruction);
+        }
+  }
+
+  if (join >= code_length)
+    return 0;
+
+  if (is_mergeable_region(at + INSTRUCTIONSIZE, end))
+    if (is_mergeable_region(target, join))
+      return join;
+
+  return 0;
+}
+
+void find_join_points() {
+  uint64_t at;
+
+  join_points = zalloc(code_length / INSTRUCTIONSIZE * sizeof(uint64_t));
+
+  merge_values  = (uint64_t*) malloc(sizeof(uint64_t) * 2 * NUMBEROFREGISTERS);
+  merge_terms   = (uint64_t*) malloc(sizeof(uint64_t) * 2 * NUMBEROFREGISTERS);
+  merge_types   = (uint8_t*)  malloc(sizeof(uint8_t)  * 2 * NUMBEROFREGISTERS);
+  merge_written = (uint8_t*)  malloc(sizeof(uint8_t)  * 2 * NUMBEROFREGISTERS);
+
+  at = 0;
+
+  while (at < code_length) {
+    join_points[at / INSTRUCTIONSIZE] = find_join_point(at);
+
+    if (join_points[at / INSTRUCTIONSIZE] != 0)
+      number_of_regions = number_of_regions + 1;
+
+    at = at + INSTRUCTIONSIZE;
+  }
+}
+
+// register reg of a side as term, side is 1 for the true one
+uint64_t merge_operand(uint64_t side, uint64_t reg) {
+  uint64_t r;
+
+  r = side * NUMBEROFREGISTERS + reg;
+
+  if (merge_types[r] == SYMBOLIC_T)
+    return merge_terms[r];
+  else
+    return bv_const(merge_values[r]);
+}
+
+// the word at vaddr as seen by a side, returns 0 if it cannot be loaded
+uint64_t merge_load(uint64_t side, uint64_t vaddr, uint8_t* type, uint64_t* value, uint64_t* term) {
+  uint64_t i;
+  uint64_t mrv;
+
+  i = merge_stores[side].size();
+
+  while (i > 0) {
+    i = i - 4;
+
+    if (merge_stores[side][i] == vaddr) {
+      *type  = (uint8_t) merge_stores[side][i + 1];
+      *value = merge_stores[side][i + 2];
+      *term  = merge_stores[side][i + 3];
+
+      return 1;
+    }
+  }
+
+  if (is_valid_virtual_address(vaddr) == 0)
+    return 0;
+  else if (is_virtual_address_mapped(pt, vaddr) == 0)
+    return 0;
+
+  if (current_activation != 0)
+    summary_log_access(vaddr, 1);
+
+  mrv = load_symbolic_memory(pt, vaddr);
+
+  *type  = *(is_symbolics    + mrv);
+  *value = *(values          + mrv);
+  *term  = *(symbolic_values + mrv);
+
+  return 1;
+}
+
+// evaluates the instructions of a side from offset from up to offset
+// to like the engine does, returns 0 if the side cannot be merged
+uint64_t merge_execute(uint64_t side, uint64_t from, uint64_t to) {
+  uint64_t instruction;
+  uint64_t op;
+  uint64_t d;
+  uint64_t s1;
+  uint64_t s2;
+  uint64_t i;
+  uint8_t  type;
+  uint64_t value;
+  uint64_t term;
+  uint64_t r;
+
+  r = side * NUMBEROFREGISTERS;
+
+  while (from < to) {
+    instruction = load_instruction(from);
+
+    op = get_opcode(instruction);
+    d  = get_rd(instruction);
+    s1 = get_rs1(instruction);
+    s2 = get_rs2(instruction);
+
+    term = 0;
+
+    if (op == OP_LUI) {
+      type  = CONCRETE_T;
+      value = get_immediate_u_format(instruction) << 12;
+    } else if (op == OP_IMM) {
+      i = get_immediate_i_format(instruction);
+
+      type  = merge_types[r + s1];
+      value = merge_values[r + s1] + i;
+
+      if (type == SYMBOLIC_T)
+        term = bv_add(merge_terms[r + s1], bv_const(i));
+    } else if (op == OP_OP) {
+      type = merge_types[r + s1] | merge_types[r + s2];
+
+      if (get_funct7(instruction) == F7_ADD) {
+        value = merge_values[r + s1] + merge_values[r + s2];
+
+        if (type == SYMBOLIC_T)
+          term = bv_add(merge_operand(side, s1), merge_operand(side, s2));
+      } else if (get_funct7(instruction) == F7_SUB) {
+        value = merge_values[r + s1] - merge_values[r + s2];
+
+        if (type == SYMBOLIC_T)
+          term = bv_sub(merge_operand(side, s1), merge_operand(side, s2));
+      } else {
+        value = merge_values[r + s1] * merge_values[r + s2];
+
+        if (type == SYMBOLIC_T)
+          term = bv_mul(merge_operand(side, s1), merge_operand(side, s2));
+      }
+    } else if (merge_types[r + s1] == SYMBOLIC_T)
+      // the engine itself only follows concrete addresses
+      return 0;
+    else if (op == OP_LD) {
+      if (merge_load(side, merge_values[r + s1] + get_immediate_i_format(instruction), &type, &value, &term) == 0)
+        return 0;
+    } else {
+      // sd
+      value = merge_values[r + s1] + get_immediate_s_format(instruction);
+
+      if (is_valid_virtual_address(value) == 0)
+        return 0;
+      else if (is_virtual_address_mapped(pt, value) == 0)
+        return 0;
+
+      merge_stores[side].push_back(value);
+      merge_stores[side].push_back(merge_types[r + s2]);
+      merge_stores[side].push_back(merge_values[r + s2]);
+
+      if (merge_types[r + s2] == SYMBOLIC_T)
+        merge_stores[side].push_back(merge_terms[r + s2]);
+      else
+        merge_stores[side].push_back(0);
+
+      d = REG_ZR;
+    }
+
+    if (d != REG_ZR) {
+      merge_types[r + d]   = type;
+      merge_values[r + d]  = value;
+      merge_terms[r + d]   = term;
+      merge_written[r + d] = 1;
+    }
+
+    from = from + INSTRUCTIONSIZE;
+  }
+
+  return 1;
+}
+
+// the value of the true side if the condition holds, of the false
+// side otherwise, concrete if both sides agree on a concrete value
+uint8_t merge_value(uint64_t condition, uint8_t* types, uint64_t* values_, uint64_t* terms, uint64_t* value, uint64_t* term) {
+  *value = values_[1];
+
+  if (types[0] == CONCRETE_T)
+    if (types[1] == CONCRETE_T)
+      if (values_[0] == values_[1]) {
+        *term = 0;
+
+        return CONCRETE_T;
+      }
+
+  if (types[1] == CONCRETE_T)
+    terms[1] = bv_const(values_[1]);
+  if (types[0] == CONCRETE_T)
+    terms[0] = bv_const(values_[0]);
+
+  *term = bv_ite(condition, terms[1], terms[0]);
+
+  return SYMBOLIC_T;
+}
+
+// merges the region of the beq following the symbolic sltu at pc,
+// returns 0 if the branch is to be forked
+uint64_t sase_merge(uint8_t is_branch) {
+  uint64_t at;
+  uint64_t instruction;
+  uint64_t target;
+  uint64_t end;
+  uint64_t join;
+  uint64_t condition;
+  uint64_t reg;
+  uint64_t side;
+  uint64_t i;
+  uint64_t j;
+  uint64_t vaddr;
+  uint8_t  types[2];
+  uint64_t values_[2];
+  uint64_t terms[2];
+  uint64_t value;
+  uint64_t term;
+  uint8_t  type;
+
+  // the true side falls through the beq
+  if (is_branch == 2) {
+    at        = pc + 3 * INSTRUCTIONSIZE - entry_point;
+    condition = bv_uge(sase_term(rs1), sase_term(rs2));
+  } else {
+    at        = pc + INSTRUCTIONSIZE - entry_point;
+    condition = bv_ult(sase_term(rs1), sase_term(rs2));
+  }
+
+  join = join_points[at / INSTRUCTIONSIZE];
+
+  if (join == 0)
+    return 0;
+
+  instruction = load_instruction(at);
+
+  if (get_rs1(instruction) != rd)
+    return 0;
+  else if (get_rs2(instruction) != REG_ZR)
+    return 0;
+
+  target = at + get_immediate_b_format(instruction);
+
+  if (join == target)
+    end = target;
+  else
+    end = target - INSTRUCTIONSIZE;
+
+  side = 0;
+
+  while (side < 2) {
+    reg = 0;
+
+    while (reg < NUMBEROFREGISTERS) {
+      merge_types[side * NUMBEROFREGISTERS + reg]   = sase_regs_typ[reg];
+      merge_values[side * NUMBEROFREGISTERS + reg]  = registers[reg];
+      merge_terms[side * NUMBEROFREGISTERS + reg]   = sase_regs[reg];
+      merge_written[side * NUMBEROFREGISTERS + reg] = 0;
+
+      reg = reg + 1;
+    }
+
+    // the beq decides on rd which is 1 on the true side
+    merge_types[side * NUMBEROFREGISTERS + rd]   = CONCRETE_T;
+    merge_values[side * NUMBEROFREGISTERS + rd]  = side;
+    merge_written[side * NUMBEROFREGISTERS + rd] = 1;
+
+    merge_stores[side].clear();
+
+    side = side + 1;
+  }
+
+  if (merge_execute(1, at + INSTRUCTIONSIZE, end) == 0) {
+    aborted_merges = aborted_merges + 1;
+
+    return 0;
+  } else if (merge_execute(0, target, join) == 0) {
+    aborted_merges = aborted_merges + 1;
+
+    return 0;
+  }
+
+  reg = 1;
+
+  while (reg < NUMBEROFREGISTERS) {
+    if (merge_written[reg] + merge_written[NUMBEROFREGISTERS + reg] > 0) {
+      side = 0;
+
+      while (side < 2) {
+        types[side]   = merge_types[side * NUMBEROFREGISTERS + reg];
+        values_[side] = merge_values[side * NUMBEROFREGISTERS + reg];
+        terms[side]   = merge_terms[side * NUMBEROFREGISTERS + reg];
+
+        side = side + 1;
+      }
+
+      sase_regs_typ[reg] = merge_value(condition, types, values_, terms, &value, &term);
+      registers[reg]     = value;
+
+      if (sase_regs_typ[reg] == SYMBOLIC_T)
+        sase_regs[reg] = term;
+    }
+
+    reg = reg + 1;
+  }
+
+  // every word stored on either side is stored once, merged
+  side = 0;
+
+  while (side < 2) {
+    i = 0;
+
+    while (i < merge_stores[side].size()) {
+      vaddr = merge_stores[side][i];
+
+      // the last store of a side to vaddr, and on the false side
+      // only if the true side has not stored to vaddr
+      j = i + 4;
+
+      while (j < merge_stores[side].size()) {
+        if (merge_stores[side][j] == vaddr)
+          vaddr = 0;
+
+        j = j + 4;
+      }
+
+      if (side == 0) {
+        j = 0;
+
+        while (j < merge_stores[1].size()) {
+          if (merge_stores[1][j] == vaddr)
+            vaddr = 0;
+
+          j = j + 4;
+        }
+      }
+
+      if (vaddr != 0) {
+        merge_load(1, vaddr, &types[1], &values_[1], &terms[1]);
+        merge_load(0, vaddr, &types[0], &values_[0], &terms[0]);
+
+        type = merge_value(condition, types, values_, terms, &value, &term);
+
+        sase_store_memory(pt, vaddr, type, value, term);
+      }
+
+      i = i + 4;
+    }
+
+    side = side + 1;
+  }
+
+  merged_branches     = merged_branches + 1;
+  merged_instructions = merged_instructions + (end - at - INSTRUCTIONSIZE + join - target) / INSTRUCTIONSIZE;
+
+  pc = entry_point + join;
+
+  return 1;
+}
+
+// with -summaries, procedure calls are summarized. the shape of a
+// call is its procedure and the words it pops off the stack, its
+// parameters, which are concrete values or symbolic terms. symbolic
+// parameters are abstracted into variables p_j of the summary, and
+// equal terms into the same one. the first call of a shape records
+// every path through the callee which returns: the symbolic
+// decisions taken on it, the stores outliving the call and the
+// return value in a0, all in terms of p_j. the summary is complete
+// once that call is backtracked. later calls of the shape do not
+// execute the callee but apply one recorded path after the other.
+// a path is a trace level of its own whose false branch is the
+// negation of its decisions, the last path takes no level.
+//
+// the constraints of the path on the variables of the parameters
+// are part of the shape, so that a decision within the callee is
+// infeasible for every call of the shape or for none. a callee
+// which loads memory outside its stack frame, divides by a symbolic
+// divisor, makes a system call or whose terms depend on more than
+// its parameters poisons the summary and is always executed
+
+void init_summaries() {
+  procedure_parameters = zalloc(MAX_CODE_LENGTH / INSTRUCTIONSIZE * sizeof(uint64_t));
+  hits_per_procedure   = zalloc(MAX_CODE_LENGTH / INSTRUCTIONSIZE * sizeof(uint64_t));
+  call_arguments       = zalloc(MAX_PARAMETERS * sizeof(uint64_t));
+
+  sase_activations       = (uint64_t*) malloc(sizeof(uint64_t) * sase_trace_size);
+  sase_activation_counts = (uint64_t*) malloc(sizeof(uint64_t) * sase_trace_size);
+  sase_summary_logs      = (uint64_t*) malloc(sizeof(uint64_t) * sase_trace_size);
+  sase_summary_ids       = (uint64_t*) malloc(sizeof(uint64_t) * sase_trace_size);
+  sase_summary_nexts     = (uint64_t*) malloc(sizeof(uint64_t) * sase_trace_size);
+
+  summary_states.push_back(SUMMARY_POISONED);
+  summary_levels.push_back(0);
+  summary_starts.push_back(std::vector<uint64_t>());
+
+  activation_parents.push_back(0);
+  activation_returns.push_back(0);
+  activation_sps.push_back(0);
+  activation_procedures.push_back(0);
+  activation_summaries.push_back(0);
+  activation_recorders.push_back(0);
+  activation_logs.push_back(0);
+  argument_terms.resize(MAX_PARAMETERS);
+}
+
+uint64_t is_recording() {
+  uint64_t recorder;
+
+  recorder = activation_recorders[current_activation];
+
+  if (recorder == 0)
+    return 0;
+  else
+    return summary_states[activation_summaries[recorder]] == SUMMARY_RECORDING;
+}
+
+void summary_log_decision(uint64_t condition) {
+  if (is_recording()) {
+    summary_log.push_back(0);
+    summary_log.push_back(condition);
+  }
+}
+
+void summary_log_access(uint64_t vaddr, uint64_t is_load) {
+  if (is_recording()) {
+    summary_log.push_back(vaddr);
+    summary_log.push_back(is_load);
+  }
+}
+
+// the activation and all its callers see whatever the activation saw
+void poison_summaries(uint64_t activation) {
+  uint64_t s;
+
+  while (activation != 0) {
+    s = activation_summaries[activation];
+
+    if (summary_states[s] == SUMMARY_RECORDING) {
+      summary_states[s] = SUMMARY_POISONED;
+
+      poisoned_summaries = poisoned_summaries + 1;
+    }
+
+    activation = activation_parents[activation];
+  }
+}
+
+void push_activation(uint64_t procedure, uint64_t summary) {
+  uint64_t activation;
+  uint64_t j;
+
+  activation = activation_parents.size();
+
+  activation_parents.push_back(current_activation);
+  activation_returns.push_back(*(registers + REG_RA));
+  activation_sps.push_back(*(registers + REG_SP));
+  activation_procedures.push_back(procedure);
+  activation_summaries.push_back(summary);
+  activation_logs.push_back(summary_log.size());
+
+  if (summary != 0)
+    activation_recorders.push_back(activation);
+  else
+    activation_recorders.push_back(activation_recorders[current_activation]);
+
+  j = 0;
+
+  while (j < MAX_PARAMETERS) {
+    if (summary != 0)
+      argument_terms.push_back(*(call_arguments + j));
+    else
+      argument_terms.push_back(0);
+
+    j = j + 1;
+  }
+
+  current_activation = activation;
+}
+
+// returns from the current activation which is discarded unless a
+// trace level opened within it still refers to it
+void pop_activation() {
+  uint64_t activation;
+
+  activation = current_activation;
+
+  current_activation = activation_parents[activation];
+
+  if (activation + 1 == activation_parents.size()) {
+    if (sase_tc == 0)
+      truncate_activations(activation);
+    else if (sase_activation_counts[sase_tc - 1] <= activation)
+      truncate_activations(activation);
+  }
+}
+
+void truncate_activations(uint64_t count) {
+  activation_parents.resize(count);
+  activation_returns.resize(count);
+  activation_sps.resize(count);
+  activation_procedures.resize(count);
+  activation_summaries.resize(count);
+  activation_recorders.resize(count);
+  activation_logs.resize(count);
+  argument_terms.resize(count * MAX_PARAMETERS);
+}
+
+// after sase_tc is decremented
+void restore_summaries() {
+  uint64_t s;
+
+  current_activation = sase_activations[sase_tc];
+  summary_resumed    = sase_summary_ids[sase_tc];
+  summary_next       = sase_summary_nexts[sase_tc];
+
+  summary_log.resize(sase_summary_logs[sase_tc]);
+
+  truncate_activations(sase_activation_counts[sase_tc]);
+
+  // all paths beneath the recording call are explored
+  while (recording_summaries.empty() == 0) {
+    s = recording_summaries.back();
+
+    if (summary_levels[s] <= sase_tc)
+      return;
+
+    if (summary_states[s] == SUMMARY_RECORDING)
+      summary_states[s] = SUMMARY_COMPLETE;
+
+    recording_summaries.pop_back();
+  }
+}
+
+// appends (0, value) to the shape for each concrete parameter and
+// (1, j) for each symbolic one where j is the first parameter with
+// the same term. call_arguments keeps the term of each such first
+// parameter, 0 for all others. returns 0 if a parameter is missing
+uint64_t load_arguments(uint64_t parameters, uint64_t sp, std::vector<uint64_t>* shape) {
+  uint64_t vaddr;
+  uint64_t mrv;
+  uint64_t i;
+  uint64_t j;
+
+  j = 0;
+
+  while (j < parameters) {
+    vaddr = sp + j * REGISTERSIZE;
+
+    *(call_arguments + j) = 0;
+
+    if (is_valid_virtual_address(vaddr) == 0)
+      return 0;
+    else if (is_virtual_address_mapped(pt, vaddr) == 0)
+      return 0;
+
+    mrv = load_symbolic_memory(pt, vaddr);
+
+    if (mrv == 0)
+      return 0;
+
+    if (*(is_symbolics + mrv) == CONCRETE_T) {
+      shape->push_back(0);
+      shape->push_back(*(values + mrv));
+    } else {
+      i = 0;
+
+      while (i < j) {
+        if (*(call_arguments + i) == *(symbolic_values + mrv))
+          break;
+
+        i = i + 1;
+      }
+
+      shape->push_back(1);
+      shape->push_back(i);
+
+      if (i == j)
+        *(call_arguments + j) = *(symbolic_values + mrv);
+    }
+
+    j = j + 1;
+  }
+
+  return 1;
+}
+
+// the shape of a call is the procedure, the number of parameters,
+// the parameters loaded by load_arguments and finally the asserted
+// constraints on the variables of the parameters in terms of p_j
+uint64_t find_summary(uint64_t procedure, uint64_t parameters, uint64_t sp) {
+  std::map<std::vector<uint64_t>, uint64_t>::iterator it;
+  std::unordered_map<uint64_t, uint64_t> done;
+  std::unordered_map<uint64_t, uint64_t> is_parameter;
+  std::vector<uint64_t> shape;
+  std::vector<uint64_t> terms;
+  std::vector<uint64_t> term;
+  std::vector<uint64_t> variables;
+  std::vector<uint64_t> constraints;
+  std::vector<uint64_t>* keys;
+  uint64_t count;
+  uint64_t i;
+  uint64_t j;
+
+  shape.push_back(procedure);
+  shape.push_back(parameters);
+
+  if (load_arguments(parameters, sp, &shape) == 0)
+    return 0;
+
+  j = 0;
+
+  while (j < parameters) {
+    if (*(call_arguments + j) != 0)
+      terms.push_back(*(call_arguments + j));
+
+    j = j + 1;
+  }
+
+  if (terms.empty() == 0) {
+    // different parameters sharing a variable are not independent
+    count = 0;
+    i     = 0;
+
+    while (i < terms.size()) {
+      term.assign(1, terms[i]);
+
+      collect_variables(&term, &variables);
+
+      count = count + variables.size();
+
+      variables.clear();
+
+      i = i + 1;
+    }
+
+    collect_variables(&terms, &variables);
+
+    if (count != variables.size())
+      return 0;
+
+    i = 0;
+
+    while (i < variables.size()) {
+      is_parameter[variable_key(variables[i])] = 1;
+
+      i = i + 1;
+    }
+
+    abstract_arguments(call_arguments, parameters, done);
+
+    // the path so far constrains the parameters of this call only
+    // through constraints on their variables, which must not involve
+    // any other variable
+    i = 0;
+
+    while (i < asserted.size()) {
+      keys = variables_of(asserted[i]);
+
+      j = 0;
+
+      while (j < keys->size()) {
+        if (is_parameter.count((*keys)[j])) {
+          constraints.push_back(substitute(asserted[i], done));
+
+          break;
+        }
+
+        j = j + 1;
+      }
+
+      i = i + 1;
+    }
+
+    variables.clear();
+
+    collect_variables(&constraints, &variables);
+
+    if (variables.empty() == 0)
+      return 0;
+
+    std::sort(constraints.begin(), constraints.end());
+
+    constraints.erase(std::unique(constraints.begin(), constraints.end()), constraints.end());
+
+    shape.insert(shape.end(), constraints.begin(), constraints.end());
+  }
+
+  it = summary_index.find(shape);
+
+  if (it != summary_index.end())
+    return it->second;
+
+  summary_index[shape] = summary_states.size();
+
+  summary_states.push_back(SUMMARY_EMPTY);
+  summary_levels.push_back(0);
+  summary_starts.push_back(std::vector<uint64_t>());
+
+  return summary_states.size() - 1;
+}
+
+// seeds done with the abstraction of the given parameter terms. a
+// parameter x + d of a variable x replaces x by p_j - d, so that
+// offsets the callee adds to it are still expressed in p_j
+void abstract_arguments(uint64_t* arguments, uint64_t parameters, std::unordered_map<uint64_t, uint64_t>& done) {
+  uint64_t t;
+  uint64_t x;
+  uint64_t j;
+  uint8_t  op;
+
+  j = 0;
+
+  while (j < parameters) {
+    t = *(arguments + j);
+
+    if (t != 0) {
+      op = get_term_op(t);
+
+      if (op == TERM_INPUT || op == TERM_READ)
+        done[t] = bv_param(j);
+      else if (op == TERM_ADD || op == TERM_SUB) {
+        x = get_term_left(t);
+
+        if (get_term_op(get_term_right(t)) != TERM_CONST)
+          done[t] = bv_param(j);
+        else if (get_term_op(x) != TERM_INPUT && get_term_op(x) != TERM_READ)
+          done[t] = bv_param(j);
+        else if (op == TERM_ADD)
+          done[x] = bv_sub(bv_param(j), get_term_right(t));
+        else
+          done[x] = bv_add(bv_param(j), get_term_right(t));
+      } else
+        done[t] = bv_param(j);
+    }
+
+    j = j + 1;
+  }
+}
+
+// a path is [k, c_1..c_k, m, (vaddr, type, value, term) * m, type,
+// value and term of a0] with all terms in p_j
+void record_path(uint64_t activation) {
+  std::unordered_map<uint64_t, uint64_t> done;
+  std::unordered_map<uint64_t, uint64_t> stored;
+  std::vector<uint64_t> conditions;
+  std::vector<uint64_t> addresses;
+  std::vector<uint64_t> terms;
+  std::vector<uint64_t> variables;
+  std::vector<uint64_t> path;
+  uint64_t s;
+  uint64_t parameters;
+  uint64_t bottom;
+  uint64_t top;
+  uint64_t vaddr;
+  uint64_t mrv;
+  uint64_t t;
+  uint64_t i;
+
+  s          = activation_summaries[activation];
+  parameters = procedure_parameters[activation_procedures[activation]] - 1;
+
+  // the stack frame of the callee and its parameters are popped
+  bottom = get_program_break(current_context);
+  top    = activation_sps[activation] + parameters * REGISTERSIZE;
+
+  i = activation_logs[activation];
+
+  while (i < summary_log.size()) {
+    vaddr = summary_log[i];
+
+    if (vaddr == 0)
+      conditions.push_back(summary_log[i + 1]);
+    else if (vaddr < bottom || vaddr >= top) {
+      if (summary_log[i + 1]) {
+        poison_summaries(activation);
+
+        return;
+      } else if (stored.count(vaddr) == 0) {
+        stored[vaddr] = 1;
+
+        addresses.push_back(vaddr);
+      }
+    }
+
+    i = i + 2;
+  }
+
+  abstract_arguments(&argument_terms[activation * MAX_PARAMETERS], parameters, done);
+
+  path.push_back(conditions.size());
+
+  i = 0;
+
+  while (i < conditions.size()) {
+    t = substitute(conditions[i], done);
+
+    path.push_back(t);
+    terms.push_back(t);
+
+    i = i + 1;
+  }
+
+  path.push_back(addresses.size());
+
+  i = 0;
+
+  while (i < addresses.size()) {
+    mrv = load_symbolic_memory(pt, addresses[i]);
+
+    path.push_back(addresses[i]);
+    path.push_back(*(is_symbolics + mrv));
+    path.push_back(*(values + mrv));
+
+    if (*(is_symbolics + mrv) == SYMBOLIC_T) {
+      t = substitute(*(symbolic_values + mrv), done);
+
+      path.push_back(t);
+      terms.push_back(t);
+    } else
+      path.push_back(0);
+
+    i = i + 1;
+  }
+
+  path.push_back(sase_regs_typ[REG_A0]);
+  path.push_back(*(registers + REG_A0));
+
+  if (sase_regs_typ[REG_A0] == SYMBOLIC_T) {
+    t = substitute(sase_regs[REG_A0], done);
+
+    path.push_back(t);
+    terms.push_back(t);
+  } else
+    path.push_back(0);
+
+  // a term which is not in p_j only depends on more than the shape
+  collect_variables(&terms, &variables);
+
+  if (variables.empty() == 0) {
+    poison_summaries(activation);
+
+    return;
+  }
+
+  i = 0;
+
+  while (i < summary_starts[s].size()) {
+    if (summary_starts[s][i] + path.size() <= summary_paths.size())
+      if (std::equal(path.begin(), path.end(), summary_paths.begin() + summary_starts[s][i]))
+        return;
+
+    i = i + 1;
+  }
+
+  summary_starts[s].push_back(summary_paths.size());
+
+  summary_paths.insert(summary_paths.end(), path.begin(), path.end());
+
+  recorded_paths = recorded_paths + 1;
+}
+
+uint64_t apply_path(uint64_t summary, uint64_t path, uint64_t procedure, uint64_t parameters) {
+  std::unordered_map<uint64_t, uint64_t> done;
+  std::vector<uint64_t> conditions;
+  uint64_t p;
+  uint64_t k;
+  uint64_t m;
+  uint64_t at;
+  uint64_t sum;
+  uint64_t result;
+  uint64_t i;
+
+  p = summary_starts[summary][path];
+  k = summary_paths[p];
+  m = summary_paths[p + k + 1];
+
+  // stores go where they went for the recording call
+  i = 0;
+
+  while (i < m) {
+    if (is_valid_virtual_address(summary_paths[p + k + 2 + 4 * i]) == 0)
+      return 0;
+    else if (is_virtual_address_mapped(pt, summary_paths[p + k + 2 + 4 * i]) == 0)
+      return 0;
+
+    i = i + 1;
+  }
+
+  i = 0;
+
+  while (i < parameters) {
+    if (*(call_arguments + i) != 0)
+      done[bv_param(i)] = *(call_arguments + i);
+
+    i = i + 1;
+  }
+
+  i = 0;
+
+  while (i < k) {
+    conditions.push_back(substitute(summary_paths[p + 1 + i], done));
+
+    i = i + 1;
+  }
+
+  // the jal
+  at = *(registers + REG_RA) - INSTRUCTIONSIZE;
+
+  if (path + 1 < summary_starts[summary].size()) {
+    // at least one decision of the path does not hold
+    sum = zero_bv;
+    i   = 0;
+
+    while (i < k) {
+      sum = bv_add(sum, bv_ite(conditions[i], one_bv, zero_bv));
+
+      i = i + 1;
+    }
+
+    sase_false_branchs[sase_tc] = bv_ult(sum, bv_const(k));
+    sase_pcs[sase_tc]           = at;
+
+    solver_push();
+
+    i = 0;
+
+    while (i < k) {
+      solver_assert(conditions[i]);
+
+      i = i + 1;
+    }
+
+    sase_open_level(summary, path + 2);
+  } else {
+    i = 0;
+
+    while (i < k) {
+      solver_assert(conditions[i]);
+
+      i = i + 1;
+    }
+  }
+
+  if (current_activation != 0) {
+    i = 0;
+
+    while (i < k) {
+      summary_log_decision(conditions[i]);
+
+      i = i + 1;
+    }
+  }
+
+  if (k > 0) {
+    result = sase_check(QUERY_SUMMARY, at);
+
+    if (is_feasible(result) == 0) {
+      if (result == SOLVER_UNKNOWN)
+        if (current_activation != 0)
+          poison_summaries(current_activation);
+
+      if (result == SOLVER_UNSAT)
+        sase_backjump();
+
+      sase_backtrack_sltu(0);
+
+      return 1;
+    }
+  }
+
+  p = p + k + 2;
+  i = 0;
+
+  while (i < m) {
+    if (summary_paths[p + 1] == SYMBOLIC_T)
+      sase_store_memory(pt, summary_paths[p], SYMBOLIC_T, summary_paths[p + 2], substitute(summary_paths[p + 3], done));
+    else
+      sase_store_memory(pt, summary_paths[p], CONCRETE_T, summary_paths[p + 2], 0);
+
+    p = p + 4;
+    i = i + 1;
+  }
+
+  sase_regs_typ[REG_A0]  = summary_paths[p];
+  *(registers + REG_A0)  = summary_paths[p + 1];
+
+  if (summary_paths[p] == SYMBOLIC_T)
+    sase_regs[REG_A0] = substitute(summary_paths[p + 2], done);
+
+  // the callee pops its parameters and returns
+  *(registers + REG_SP)  = *(registers + REG_SP) + parameters * REGISTERSIZE;
+  sase_regs_typ[REG_SP]  = CONCRETE_T;
+
+  pc = *(registers + REG_RA);
+
+  summary_hits = summary_hits + 1;
+
+  *(hits_per_procedure + procedure) = *(hits_per_procedure + procedure) + 1;
+
+  return 1;
+}
+
+// after the jal of a procedure call
+void sase_call() {
+  uint64_t procedure;
+  uint64_t parameters;
+  uint64_t next;
+  uint64_t s;
+  std::vector<uint64_t> shape;
+
+  next = summary_next;
+
+  summary_next = 0;
+
+  procedure  = (pc - entry_point) / INSTRUCTIONSIZE;
+  parameters = *(procedure_parameters + procedure);
+  s          = 0;
+
+  // the negation of the paths tried so far constrains the parameters
+  // which changes the shape, so the call keeps its summary
+  if (next != 0) {
+    load_arguments(parameters - 1, *(registers + REG_SP), &shape);
+
+    if (apply_path(summary_resumed, next - 1, procedure, parameters - 1))
+      return;
+  }
+
+  if (assert_zone == 0)
+    if (parameters != 0)
+      if (parameters <= MAX_PARAMETERS + 1)
+        s = find_summary(procedure, parameters - 1, *(registers + REG_SP));
+
+  if (s != 0) {
+    if (summary_states[s] == SUMMARY_COMPLETE)
+      if (summary_starts[s].size() > 0)
+        if (apply_path(s, 0, procedure, parameters - 1))
+          return;
+
+    summary_fallbacks = summary_fallbacks + 1;
+
+    if (summary_states[s] == SUMMARY_EMPTY) {
+      summary_states[s] = SUMMARY_RECORDING;
+      summary_levels[s] = sase_tc;
+
+      recording_summaries.push_back(s);
+    } else
+      s = 0;
+  }
+
+  push_activation(procedure, s);
+}
+
+// after a jalr without link
+void sase_return() {
+  uint64_t activation;
+  uint64_t procedure;
+
+  activation = current_activation;
+
+  if (activation == 0)
+    return;
+  else if (pc != activation_returns[activation])
+    return;
+
+  procedure = activation_procedures[activation];
+
+  if (*(procedure_parameters + procedure) == 0)
+    if (*(registers + REG_SP) >= activation_sps[activation])
+      *(procedure_parameters + procedure) = (*(registers + REG_SP) - activation_sps[activation]) / REGISTERSIZE + 1;
+
+  if (is_recording())
+    if (activation_recorders[activation] == activation)
+      record_path(activation);
+
+  pop_activation();
+}
+
+// before a system call
+void sase_ecall() {
+  if (current_activation != 0)
+    poison_summaries(current_activation);
+}
+
+// the coordinator of -jobs starts the first worker on the whole
+// path tree. workers poll the free slots of the shared memory and
+// hand the false branch of their oldest open trace level, the root
+// of their largest unexplored subtree, to a new worker forked from
+// themselves. the new worker inherits trace, memory and solver state
+// by copy-on-write and never backtracks below that level
+void init_jobs() {
+  uint64_t* shared;
+
+  shared = (uint64_t*) mmap(0, 3 * sizeof(uint64_t) + MAX_CODE_LENGTH / INSTRUCTIONSIZE,
+    PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+
+  if (shared == MAP_FAILED) {
+    printf("%s\n", "cannot share memory between jobs");
+
+    exit_explorer(EXITCODE_IOERROR);
+  }
+
+  free_workers    = shared;
+  started_workers = shared + 1;
+  explored_paths  = shared + 2;
+  coverage        = (uint8_t*) (shared + 3);
+
+  *free_workers = jobs;
+}
+
+// claims a free slot, returns 0 if there is none
+uint64_t claim_worker() {
+  uint64_t n;
+
+  n = *free_workers;
+
+  while (n > 0) {
+    if (__sync_bool_compare_and_swap(free_workers, n, n - 1))
+      return 1;
+
+    n = *free_workers;
+  }
+
+  return 0;
+}
+
+void release_worker() {
+  __sync_fetch_and_add(free_workers, 1);
+}
+
+void sase_enter_worker() {
+  worker_id = __sync_add_and_fetch(started_workers, 1);
+
+  // backtracking is counted per worker and summed up when it exits
+  b = 0;
+
+  number_of_donations = 0;
+
+  dump_worker = worker_id;
+}
+
+void sase_leave_worker() {
+  __sync_fetch_and_add(explored_paths, b);
+}
+
+// returns 1 in the new worker which continues on the donated branch
+uint64_t sase_donate() {
+  uint64_t level;
+  pid_t    pid;
+
+  if (jobs < 2)
+    return 0;
+  else if (*free_workers == 0)
+    return 0;
+
+  // the donated prefix must be checked and outside of assertions
+  if (pending_branches > 0)
+    return 0;
+  else if (prefix_position < prefix_length)
+    return 0;
+  else if (assert_zone)
+    return 0;
+
+  level = sase_base;
+
+  while (level < sase_tc) {
+    if (sase_donated[level] == 0)
+      break;
+
+    level = level + 1;
+  }
+
+  if (level == sase_tc)
+    return 0;
+
+  if (claim_worker() == 0)
+    return 0;
+
+  // buffered output would be written by both processes
+  fflush(stdout);
+
+  pid = fork();
+
+  if (pid < 0) {
+    release_worker();
+
+    return 0;
+  } else if (pid > 0) {
+    sase_donated[level] = 1;
+
+    number_of_donations = number_of_donations + 1;
+
+    return 0;
+  }
+
+  sase_enter_worker();
+
+  sase_base = level;
+
+  if (level + 1 < sase_tc)
+    sase_drop_levels(level + 1);
+
+  sase_backtrack_sltu(0);
+
+  return 1;
+}
+
+void sase_ld() {
+  uint64_t mrv;
+  uint64_t vaddr = *(registers + rs1) + imm;
+
+  if (is_valid_virtual_address(vaddr)) {
+    if (is_virtual_address_mapped(pt, vaddr)) {
+      if (rd != REG_ZR) {
+        if (current_activation != 0)
+          summary_log_access(vaddr, 1);
+
+        mrv = load_symbolic_memory(pt, vaddr);
+
+        // if (mrv == 0)
+        //   printf("OUTPUT: uninitialize memory address %llu at pc %x\n", vaddr, pc - entry_point);
+
+        sase_regs_typ[rd] = *(is_symbolics    + mrv);
+        sase_regs[rd]     = *(symbolic_values + mrv);
+        registers[rd]     = *(values          + mrv);
+
+        pc = pc + INSTRUCTIONSIZE;
+        ic_ld = ic_ld + 1;
+
+      } else
+        pc = pc + INSTRUCTIONSIZE;
+    } else
+      throw_exception(EXCEPTION_PAGEFAULT, get_page_of_virtual_address(vaddr));
+  } else
+    throw_exception(EXCEPTION_INVALIDADDRESS, vaddr);
+}
+
+void sase_sd() {
+  uint64_t vaddr = *(registers + rs1) + imm;
+
+  if (is_valid_virtual_address(vaddr)) {
+    if (is_virtual_address_mapped(pt, vaddr)) {
+
+      if (sase_regs_typ[rs2] == SYMBOLIC_T)
+        sase_store_memory(pt, vaddr, SYMBOLIC_T, registers[rs2], sase_regs[rs2]);
+      else
+        sase_store_memory(pt, vaddr, CONCRETE_T, registers[rs2], 0);
+
+      pc = pc + INSTRUCTIONSIZE;
+      ic_sd = ic_sd + 1;
+    } else
+      throw_exception(EXCEPTION_PAGEFAULT, get_page_of_virtual_address(vaddr));
+  } else
+    throw_exception(EXCEPTION_INVALIDADDRESS, vaddr);
+}
+
+void sase_jal_jalr() {
+  if (rd != REG_ZR)
+    sase_regs_typ[rd] = CONCRETE_T;
+
+  if (use_summaries) {
+    if (get_opcode(ir) == OP_JAL) {
+      if (rd != REG_ZR)
+        sase_call();
+    } else if (rd == REG_ZR)
+      sase_return();
+  }
+}
+
+void sase_store_memory(uint64_t* pt, uint64_t vaddr, uint8_t is_symbolic, uint64_t value, uint64_t sym_value) {
+  uint64_t mrv;
+
+  if (current_activation != 0)
+    summary_log_access(vaddr, 0);
+
+  mrv = load_symbolic_memory(pt, vaddr);
+
+  if (mrv != 0)
+    if (is_symbolic == *(is_symbolics + mrv))
+      if (value == *(values + mrv))
+        if (sym_value == *(symbolic_values + mrv))
+          return;
+
+  if (mrif < mrv && vaddr != read_buffer) {
+    *(is_symbolics    + mrv) = is_symbolic;
+    *(values          + mrv) = value;
+    *(symbolic_values + mrv) = sym_value;
+
+  } else if (is_trace_space_available()) {
+    tc++;
+
+    *(tcs             + tc) = mrv;
+    *(is_symbolics    + tc) = is_symbolic;
+    *(values          + tc) = value;
+    *(symbolic_values + tc) = sym_value;
+    *(vaddrs          + tc) = vaddr;
+
+    store_virtual_memory(pt, vaddr, tc);
+  } else
+    throw_exception(EXCEPTION_MAXTRACE, 0);
+}
+
+void backtrack_branch_stores() {
+  while (mrif < tc) {
+    if (*(vaddrs + tc) < NUMBEROFREGISTERS) {
+      restore_registers_fp_sp_rd(tc, *(vaddrs + tc));
+    } else {
+      store_virtual_memory(pt, *(vaddrs + tc), *(tcs + tc));
+    }
+    tc--;
+  }
+}
\ No newline at end of file
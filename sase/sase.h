@@ -0,0 +1,369 @@
+/*
+  This project contains part of the Selfie Project source code
+  which is governed by a BSD license. For further information
+  and LICENSE conditions see the following website:
+  http://selfie.cs.uni-salzburg.at
+
+  Furthermore this project uses the api of the SMT solvers
+  z3, cvc4, and boolector through the solver interface
+*/
+
+#include <iostream>
+#include <stdio.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/mman.h>
+#include <sys/prctl.h>
+#include <sys/wait.h>
+#include <pthread.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <map>
+#include "solver.h"
+
+#define RED   "\x1B[31m"
+#define GREEN "\033[32m"
+#define RESET "\x1B[0m"
+
+// -----------------------------------------------------------------
+// variables and procedures which are defined in selfie.c
+// and are needed in sase engine
+// -----------------------------------------------------------------
+
+extern thread_local uint64_t rs1;
+extern thread_local uint64_t rs2;
+extern thread_local uint64_t rd;
+extern thread_local uint64_t imm;
+extern thread_local uint64_t pc;
+extern thread_local uint64_t ir;
+extern thread_local uint64_t trap;
+extern uint64_t REG_ZR;
+extern uint64_t REG_FP;
+extern uint64_t REG_SP;
+extern uint64_t REG_RA;
+extern uint64_t REG_A0;
+extern uint64_t REGISTERSIZE;
+extern uint64_t NUMBEROFREGISTERS;
+extern uint64_t OP_BRANCH;
+extern uint64_t INSTRUCTIONSIZE;
+extern uint64_t MAX_CODE_LENGTH;
+extern uint64_t EXCEPTION_MAXTRACE;
+extern uint64_t EXCEPTION_PAGEFAULT;
+extern uint64_t EXCEPTION_INVALIDADDRESS;
+extern uint64_t EXITCODE_BADARGUMENTS;
+extern uint64_t EXITCODE_IOERROR;
+extern uint64_t EXITCODE_SYMBOLICEXECUTIONERROR;
+extern uint64_t F3_ADD;
+extern uint64_t F7_SUB;
+extern uint64_t OP_IMM;
+extern uint64_t OP_OP;
+extern uint64_t F3_ADDI;
+extern uint64_t OP_LD;
+extern uint64_t OP_SD;
+extern uint64_t OP_LUI;
+extern uint64_t OP_JAL;
+extern uint64_t F3_LD;
+extern uint64_t F3_SD;
+extern uint64_t F7_ADD;
+extern uint64_t F7_MUL;
+
+extern thread_local uint64_t entry_point;
+extern thread_local uint64_t code_length;
+extern thread_local uint64_t ic_addi;
+extern thread_local uint64_t ic_sub;
+extern thread_local uint64_t ic_sltu;
+extern thread_local uint64_t ic_ld;
+extern thread_local uint64_t ic_sd;
+
+extern thread_local uint64_t* pt;
+extern thread_local uint64_t* current_context;
+extern thread_local uint64_t* registers;
+
+uint64_t* zalloc(uint64_t size);
+uint64_t is_valid_virtual_address(uint64_t vaddr);
+uint64_t get_page_of_virtual_address(uint64_t vaddr);
+uint64_t is_virtual_address_mapped(uint64_t* table, uint64_t vaddr);
+void     store_virtual_memory(uint64_t* table, uint64_t vaddr, uint64_t data);
+uint64_t load_symbolic_memory(uint64_t* pt, uint64_t vaddr);
+void     throw_exception(uint64_t exception, uint64_t faulting_page);
+uint64_t get_program_break(uint64_t* context);
+void     set_program_break(uint64_t* context, uint64_t brk);
+void     fetch();
+uint64_t load_instruction(uint64_t baddr);
+uint64_t get_opcode(uint64_t instruction);
+uint64_t get_funct7(uint64_t instruction);
+uint64_t get_funct3(uint64_t instruction);
+uint64_t get_rd(uint64_t instruction);
+uint64_t get_rs1(uint64_t instruction);
+uint64_t get_rs2(uint64_t instruction);
+uint64_t get_immediate_i_format(uint64_t instruction);
+uint64_t get_immediate_s_format(uint64_t instruction);
+uint64_t get_immediate_b_format(uint64_t instruction);
+uint64_t get_immediate_j_format(uint64_t instruction);
+uint64_t get_immediate_u_format(uint64_t instruction);
+uint64_t two_to_the_power_of(uint64_t p);
+uint64_t get_bits(uint64_t n, uint64_t i, uint64_t b);
+
+// -----------------------------------------------------------------
+// ---------------- Solver Aided Symbolic Execution ----------------
+// -----------------------------------------------------------------
+
+extern thread_local uint64_t  zero_bv;
+extern thread_local uint64_t  one_bv;
+extern thread_local uint64_t  sase_symbolic;
+extern thread_local uint64_t  b;
+extern uint64_t  SASE;
+extern uint8_t   CONCRETE_T;
+extern uint8_t   SYMBOLIC_T;
+extern thread_local uint64_t  sltu_by_interval;
+extern thread_local uint64_t  sltu_by_solver;
+extern thread_local uint64_t  explore_unknown;
+extern thread_local uint64_t  number_of_backjumps;
+extern thread_local uint64_t  skipped_levels;
+
+extern thread_local uint64_t  lazy_checks;
+extern thread_local uint64_t  deferred_branches;
+extern thread_local uint64_t  number_of_checkpoints;
+extern thread_local uint64_t  infeasible_checkpoints;
+
+extern thread_local char*     test_file_name; // test vectors of all explored paths are written there
+extern thread_local uint64_t  number_of_tests;
+
+extern thread_local uint64_t  jobs;
+extern uint64_t               number_of_explorers; // shared by all explorer threads
+extern thread_local uint64_t  worker_id;
+extern thread_local uint64_t* free_workers;
+extern thread_local uint64_t* started_workers;
+extern thread_local uint64_t* explored_paths;
+extern thread_local uint64_t  number_of_donations;
+extern thread_local uint8_t*  coverage;
+
+extern thread_local char*     coverage_log_name; // coverage over time is logged there
+extern thread_local FILE*     coverage_log;
+extern thread_local uint64_t  new_coverage;
+extern thread_local uint64_t  exploration_start;
+
+// search strategies
+extern uint64_t  SEARCH_DFS;
+extern uint64_t  SEARCH_BFS;
+extern uint64_t  SEARCH_RANDOM_PATH;
+extern uint64_t  SEARCH_COVERAGE_NEW;
+extern uint64_t  SEARCH_IDDFS;
+
+extern thread_local uint64_t  search;
+extern thread_local uint64_t  depth_bound;
+extern thread_local char*     prefix_file_name;
+extern thread_local uint64_t  split;
+extern thread_local char*     split_directory;
+extern thread_local uint64_t  prefix_length;
+extern thread_local uint64_t  prefix_position;
+extern thread_local char*     checkpoint_file_name;
+extern thread_local uint64_t  checkpoint_interval;
+extern thread_local char*     resume_file_name;
+extern thread_local uint64_t  number_of_saves;
+
+extern thread_local uint64_t  number_of_restarts;
+extern thread_local uint64_t  number_of_resumes;
+extern thread_local uint64_t  number_of_cut_paths;
+
+extern thread_local uint64_t  merge_regions;
+extern thread_local uint64_t  number_of_regions;
+extern thread_local uint64_t  merged_branches;
+extern thread_local uint64_t  merged_instructions;
+extern thread_local uint64_t  aborted_merges;
+
+// function summaries
+extern thread_local uint64_t  use_summaries;
+extern uint64_t  MAX_PARAMETERS;
+extern thread_local uint64_t* procedure_parameters;
+extern thread_local uint64_t* hits_per_procedure;
+extern thread_local uint64_t  summary_hits;
+extern thread_local uint64_t  summary_fallbacks;
+extern thread_local uint64_t  recorded_paths;
+extern thread_local uint64_t  poisoned_summaries;
+
+extern uint64_t  SUMMARY_EMPTY;
+extern uint64_t  SUMMARY_RECORDING;
+extern uint64_t  SUMMARY_COMPLETE;
+extern uint64_t  SUMMARY_POISONED;
+
+extern thread_local std::map<std::vector<uint64_t>, uint64_t> summary_index;
+extern thread_local std::vector<uint64_t> summary_states;
+extern thread_local std::vector<uint64_t> summary_levels;
+extern thread_local std::vector<std::vector<uint64_t>> summary_starts;
+extern thread_local std::vector<uint64_t> summary_paths;
+extern thread_local std::vector<uint64_t> recording_summaries;
+
+extern thread_local std::vector<uint64_t> activation_parents;
+extern thread_local std::vector<uint64_t> activation_returns;
+extern thread_local std::vector<uint64_t> activation_sps;
+extern thread_local std::vector<uint64_t> activation_procedures;
+extern thread_local std::vector<uint64_t> activation_summaries;
+extern thread_local std::vector<uint64_t> activation_recorders;
+extern thread_local std::vector<uint64_t> activation_logs;
+extern thread_local std::vector<uint64_t> argument_terms;
+extern thread_local uint64_t  current_activation;
+extern thread_local uint64_t* call_arguments;
+
+extern thread_local std::vector<uint64_t> summary_log;
+extern thread_local uint64_t  summary_resumed;
+extern thread_local uint64_t  summary_next;
+
+// solver queries by call site
+extern uint64_t  QUERY_SLTU;
+extern uint64_t  QUERY_BACKTRACK;
+extern uint64_t  QUERY_DIVU;
+extern uint64_t  QUERY_REMU;
+extern uint64_t  QUERY_ASSERT;
+extern uint64_t  QUERY_CHECKPOINT;
+extern uint64_t  QUERY_BISECT;
+extern uint64_t  QUERY_TEST;
+extern uint64_t  QUERY_SUMMARY;
+extern uint64_t  NUMBER_OF_QUERY_SITES;
+extern uint64_t  LATENCY_BUCKETS;
+
+extern thread_local uint64_t* site_results;   // sat, unsat and unknown results of each site
+extern thread_local uint64_t* site_times;     // cumulative latency of each site in microseconds
+extern thread_local uint64_t* site_max_times; // maximum latency of each site
+extern thread_local uint64_t* site_latencies; // latency histogram of each site
+
+// solver queries by instruction, indexed like the other profile counters
+extern thread_local uint64_t  query_time;
+extern thread_local uint64_t  number_of_unsat_queries;
+extern thread_local uint64_t* queries_per_instruction;
+extern thread_local uint64_t* unsat_per_instruction;
+extern thread_local uint64_t* unknown_per_instruction;
+extern thread_local uint64_t* query_time_per_instruction;
+
+// symbolic registers
+extern thread_local uint64_t* sase_regs;
+extern thread_local uint8_t*  sase_regs_typ;
+
+// engine trace
+extern thread_local uint64_t  sase_trace_size;
+extern thread_local uint64_t  sase_tc;
+extern thread_local uint64_t* sase_pcs;
+extern thread_local uint64_t* sase_false_branchs;
+extern thread_local uint64_t* sase_read_trace_ptrs;
+extern thread_local uint64_t* sase_program_brks;
+extern thread_local uint64_t* sase_store_trace_ptrs;
+extern thread_local uint64_t* sase_rds;
+extern thread_local uint64_t  mrif;
+extern thread_local uint64_t  sase_base;
+extern thread_local uint8_t*  sase_donated;
+extern thread_local uint64_t* sase_pending_nodes;
+extern thread_local uint64_t* sase_activations;
+extern thread_local uint64_t* sase_activation_counts;
+extern thread_local uint64_t* sase_summary_logs;
+extern thread_local uint64_t* sase_summary_ids;
+extern thread_local uint64_t* sase_summary_nexts;
+extern thread_local uint8_t   which_branch;
+extern thread_local uint8_t   assert_zone;
+
+// store trace
+extern thread_local uint64_t  tc;
+extern thread_local uint64_t* tcs;
+extern thread_local uint64_t* vaddrs;
+extern thread_local uint64_t* values;
+extern thread_local uint8_t*  is_symbolics;
+extern thread_local uint64_t* symbolic_values;
+
+// read trace
+extern thread_local uint64_t* concrete_reads;
+extern thread_local uint64_t* constrained_reads;
+extern thread_local uint64_t  read_tc;
+extern thread_local uint64_t  read_tc_current;
+extern thread_local uint64_t  read_buffer;
+
+// input trace
+extern thread_local uint64_t  input_cnt;
+extern thread_local uint64_t  input_cnt_current;
+extern thread_local uint64_t* constrained_inputs;
+
+// ********************** engine functions ************************
+
+void store_registers_fp_sp_rd();
+void restore_registers_fp_sp_rd(uint64_t tr_cnt, uint64_t rd_reg);
+uint8_t match_sub(uint64_t prev_instr_rd);
+uint8_t match_addi();
+uint8_t check_next_1_instrs();
+uint8_t check_next_3_instrs();
+
+void init_sase();
+void sase_lui();
+void sase_addi();
+void sase_add();
+void sase_sub();
+void sase_mul();
+void sase_divu();
+void sase_remu();
+void sase_sltu();
+void sase_open_level(uint64_t summary, uint64_t path);
+void sase_restore_level();
+void sase_backtrack_sltu(int is_true_branch_unreachable);
+uint64_t sase_backjump();
+uint64_t sase_backjump_to(uint64_t bound);
+void     sase_drop_levels(uint64_t level);
+void     sase_emit_test(uint64_t needs_check);
+void     sase_defer_check(uint64_t at);
+uint64_t sase_checkpoint(uint64_t at); // returns 0 if the path was infeasible and has been backtracked
+uint64_t is_feasible(uint64_t result); // unknown results count as feasible if explore_unknown is set
+uint64_t sase_check(uint64_t site, uint64_t at); // solver_check on behalf of the instruction at address at
+uint64_t sase_check_prefix(uint64_t site, uint64_t at, uint64_t length);
+uint64_t latency_percentile(uint64_t site, uint64_t p);
+void     init_search();
+uint64_t new_node(uint64_t parent, uint8_t decision, uint64_t at, uint64_t branch);
+uint64_t branch_target(uint64_t at);
+uint64_t next_random();
+uint64_t select_pending(); // index into the frontier
+void     sase_snapshot();
+void     sase_restart(uint64_t node);
+void     sase_take_false_branch(uint64_t node, uint64_t needs_check);
+void     sase_search_sltu(uint64_t at);
+void     sase_next_path();
+uint64_t is_false_branch_feasible(uint64_t at);
+void     read_prefix();
+void     sase_replay_prefix(uint64_t at);
+void     write_prefix(uint64_t node, char* name);
+void     write_prefixes();
+void     save_exploration();
+void     load_exploration();
+uint64_t is_mergeable_instruction(uint64_t instruction);
+uint64_t is_mergeable_region(uint64_t from, uint64_t to);
+uint64_t find_join_point(uint64_t at);
+void     find_join_points();
+uint64_t merge_operand(uint64_t side, uint64_t reg);
+uint64_t merge_load(uint64_t side, uint64_t vaddr, uint8_t* type, uint64_t* value, uint64_t* term);
+uint64_t merge_execute(uint64_t side, uint64_t from, uint64_t to);
+uint8_t  merge_value(uint64_t condition, uint8_t* types, uint64_t* values_, uint64_t* terms, uint64_t* value, uint64_t* term);
+uint64_t sase_merge(uint8_t is_branch); // returns 0 if the branch is to be forked
+void     init_summaries();
+uint64_t is_recording();
+void     summary_log_decision(uint64_t condition);
+void     summary_log_access(uint64_t vaddr, uint64_t is_load);
+void     poison_summaries(uint64_t activation);
+void     push_activation(uint64_t procedure, uint64_t summary);
+void     pop_activation();
+void     truncate_activations(uint64_t count);
+void     restore_summaries();
+uint64_t load_arguments(uint64_t parameters, uint64_t sp, std::vector<uint64_t>* shape);
+uint64_t find_summary(uint64_t procedure, uint64_t parameters, uint64_t sp); // 0 if the call cannot be summarized
+void     abstract_arguments(uint64_t* arguments, uint64_t parameters, std::unordered_map<uint64_t, uint64_t>& done);
+void     record_path(uint64_t activation);
+uint64_t apply_path(uint64_t summary, uint64_t path, uint64_t procedure, uint64_t parameters); // returns 0 if the callee is to be executed
+void     sase_call();
+void     sase_return();
+void     sase_ecall();
+void     init_jobs();
+uint64_t claim_worker(); // returns 0 if no worker may be started
+void     release_worker();
+void     sase_enter_worker();
+void     sase_leave_worker();
+uint64_t sase_donate(); // returns 1 in the forked worker
+void sase_ld();
+void sase_sd();
+void sase_jal_jalr();
+void sase_store_memory(uint64_t* pt, uint64_t vaddr, uint8_t is_symbolic, uint64_t value, uint64_t sym_value);
+void backtrack_branch_stores();
\ No newline at end of file
@@ -0,0 +1,1203 @@
+/*
+  This project contains part of the Selfie Project source code
+  which is governed by a BSD license. For further information
+  and LICENSE conditions see the following website:
+  http://selfie.cs.uni-salzburg.at
+
+  The solver interface hides the api of the SMT solvers
+  (z3, cvc4, boolector) behind engine-owned terms so that
+  the backend can be selected at runtime.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <vector>
+#include "solver.h"
+
+extern uint64_t EXITCODE_BADARGUMENTS;
+
+// -----------------------------------------------------------------
+// ------------------------- SOLVER TERMS --------------------------
+// -----------------------------------------------------------------
+
+uint8_t TERM_CONST = 0;
+uint8_t TERM_INPUT = 1;
+uint8_t TERM_READ  = 2;
+uint8_t TERM_ADD   = 3;
+uint8_t TERM_SUB   = 4;
+uint8_t TERM_MUL   = 5;
+uint8_t TERM_UDIV  = 6;
+uint8_t TERM_UREM  = 7;
+uint8_t TERM_ULT   = 8;
+uint8_t TERM_UGE   = 9;
+uint8_t TERM_ULE   = 10;
+uint8_t TERM_EQ    = 11;
+uint8_t TERM_ITE   = 12;
+uint8_t TERM_PARAM = 13;
+
+thread_local uint8_t*  term_ops;
+thread_local uint64_t* term_lefts;
+thread_local uint64_t* term_rights;
+thread_local uint64_t* term_values;
+thread_local uint64_t* term_hashes;
+thread_local uint64_t  number_of_terms = 1;       // term 0 is never used
+thread_local uint64_t  max_number_of_terms = 0;
+
+thread_local char      name_buffer[32];           // a buffer for variable names
+
+// hash-consing: open addressing table of term indices, 0 is empty
+thread_local uint64_t* unique_table      = 0;
+thread_local uint64_t  unique_table_size = 0;
+
+uint64_t  TWO_TO_THE_63 = 9223372036854775808ULL;
+
+thread_local uint64_t  number_of_shared_terms = 0; // terms found in the unique table
+thread_local uint64_t  number_of_folded_terms = 0; // terms folded into constants
+
+uint8_t  get_term_op(uint64_t t)    { return term_ops[t]; }
+uint64_t get_term_left(uint64_t t)  { return term_lefts[t]; }
+uint64_t get_term_right(uint64_t t) { return term_rights[t]; }
+uint64_t get_term_value(uint64_t t) { return term_values[t]; }
+uint64_t get_term_hash(uint64_t t)  { return term_hashes[t]; }
+
+uint64_t mix_hash(uint64_t h, uint64_t v) {
+  h = (h ^ v) * 0x9E3779B97F4A7C15ULL;
+
+  return h ^ (h >> 31);
+}
+
+uint64_t is_variable(uint64_t t) {
+  return term_ops[t] == TERM_INPUT || term_ops[t] == TERM_READ;
+}
+
+char* variable_name(uint64_t t) {
+  if (term_ops[t] == TERM_INPUT)
+    sprintf(name_buffer, "in_%llu", (unsigned long long) term_values[t]);
+  else
+    sprintf(name_buffer, "rv_%llu", (unsigned long long) term_values[t]);
+
+  return name_buffer;
+}
+
+char* variable_name_at(uint64_t t, uint64_t width) {
+  if (width == 64)
+    return variable_name(t);
+
+  if (term_ops[t] == TERM_INPUT)
+    sprintf(name_buffer, "in_%llu_w%llu", (unsigned long long) term_values[t], (unsigned long long) width);
+  else
+    sprintf(name_buffer, "rv_%llu_w%llu", (unsigned long long) term_values[t], (unsigned long long) width);
+
+  return name_buffer;
+}
+
+uint64_t value_at(uint64_t value, uint64_t width) {
+  if (width >= 64)
+    return value;
+  else
+    return value & ((1ULL << width) - 1);
+}
+
+uint64_t variable_key(uint64_t t) {
+  return 2 * term_values[t] + (term_ops[t] == TERM_READ);
+}
+
+uint64_t append_term(uint8_t op, uint64_t left, uint64_t right, uint64_t value, uint64_t hash) {
+  if (number_of_terms >= max_number_of_terms) {
+    // the term table grows on demand
+    if (max_number_of_terms == 0)
+      max_number_of_terms = 1048576;
+    else
+      max_number_of_terms = 2 * max_number_of_terms;
+
+    term_ops    = (uint8_t*)  realloc(term_ops,    sizeof(uint8_t)  * max_number_of_terms);
+    term_lefts  = (uint64_t*) realloc(term_lefts,  sizeof(uint64_t) * max_number_of_terms);
+    term_rights = (uint64_t*) realloc(term_rights, sizeof(uint64_t) * max_number_of_terms);
+    term_values = (uint64_t*) realloc(term_values, sizeof(uint64_t) * max_number_of_terms);
+    term_hashes = (uint64_t*) realloc(term_hashes, sizeof(uint64_t) * max_number_of_terms);
+
+    if (term_ops == 0 || term_lefts == 0 || term_rights == 0 || term_values == 0 || term_hashes == 0) {
+      printf("%s\n", "term table exceeds available memory");
+      exit_explorer(EXIT_FAILURE);
+    }
+  }
+
+  term_ops[number_of_terms]    = op;
+  term_lefts[number_of_terms]  = left;
+  term_rights[number_of_terms] = right;
+  term_values[number_of_terms] = value;
+  term_hashes[number_of_terms] = hash;
+
+  number_of_terms = number_of_terms + 1;
+
+  return number_of_terms - 1;
+}
+
+void grow_unique_table() {
+  uint64_t* old_table = unique_table;
+  uint64_t  old_size  = unique_table_size;
+  uint64_t  i = 0;
+  uint64_t  j;
+
+  if (unique_table_size == 0)
+    unique_table_size = 2097152;
+  else
+    unique_table_size = 2 * unique_table_size;
+
+  unique_table = (uint64_t*) calloc(unique_table_size, sizeof(uint64_t));
+
+  if (unique_table == 0) {
+    printf("%s\n", "unique table exceeds available memory");
+    exit_explorer(EXIT_FAILURE);
+  }
+
+  while (i < old_size) {
+    if (old_table[i] != 0) {
+      j = term_hashes[old_table[i]] & (unique_table_size - 1);
+
+      while (unique_table[j] != 0)
+        j = (j + 1) & (unique_table_size - 1);
+
+      unique_table[j] = old_table[i];
+    }
+
+    i = i + 1;
+  }
+
+  free(old_table);
+}
+
+uint64_t new_term(uint8_t op, uint64_t left, uint64_t right, uint64_t value) {
+  uint64_t hash;
+  uint64_t i;
+  uint64_t t;
+
+  // structurally equal terms have equal hashes regardless of their index
+  if (op <= TERM_READ || op == TERM_PARAM)
+    hash = mix_hash(mix_hash(op + 1, value), 0);
+  else
+    hash = mix_hash(mix_hash(op + 1, term_hashes[left]), term_hashes[right]);
+
+  if (op == TERM_ITE)
+    hash = mix_hash(hash, term_hashes[value]);
+
+  // keep the unique table at most half full
+  if (2 * number_of_terms >= unique_table_size)
+    grow_unique_table();
+
+  // operands are unique already, so comparing them by index suffices
+  i = hash & (unique_table_size - 1);
+
+  while (unique_table[i] != 0) {
+    t = unique_table[i];
+
+    if (term_hashes[t] == hash)
+      if (term_ops[t] == op)
+        if (term_lefts[t] == left)
+          if (term_rights[t] == right)
+            if (term_values[t] == value) {
+              number_of_shared_terms = number_of_shared_terms + 1;
+
+              return t;
+            }
+
+    i = (i + 1) & (unique_table_size - 1);
+  }
+
+  t = append_term(op, left, right, value, hash);
+
+  unique_table[i] = t;
+
+  return t;
+}
+
+// bit-vector semantics of binary operators, division by zero
+// follows smt-lib
+uint64_t apply_op(uint8_t op, uint64_t l, uint64_t r) {
+  if (op == TERM_ADD)
+    return l + r;
+  else if (op == TERM_SUB)
+    return l - r;
+  else if (op == TERM_MUL)
+    return l * r;
+  else if (op == TERM_UDIV) {
+    if (r == 0)
+      return -1;
+    else
+      return l / r;
+  } else if (op == TERM_UREM) {
+    if (r == 0)
+      return l;
+    else
+      return l % r;
+  } else if (op == TERM_ULT)
+    return l < r;
+  else if (op == TERM_UGE)
+    return l >= r;
+  else if (op == TERM_ULE)
+    return l <= r;
+  else
+    return l == r;
+}
+
+uint64_t is_constant(uint64_t t) {
+  return term_ops[t] == TERM_CONST;
+}
+
+uint64_t fold(uint8_t op, uint64_t a, uint64_t b) {
+  number_of_folded_terms = number_of_folded_terms + 1;
+
+  return bv_const(apply_op(op, term_values[a], term_values[b]));
+}
+
+// x + d in affine normal form: at most one constant offset, added if
+// it is below 2^63 and subtracted otherwise
+uint64_t bv_offset(uint64_t x, uint64_t d) {
+  if (term_ops[x] == TERM_ADD) {
+    if (is_constant(term_rights[x])) {
+      d = d + term_values[term_rights[x]];
+      x = term_lefts[x];
+    }
+  } else if (term_ops[x] == TERM_SUB)
+    if (is_constant(term_rights[x])) {
+      d = d - term_values[term_rights[x]];
+      x = term_lefts[x];
+    }
+
+  if (d == 0)
+    return x;
+  else if (d < TWO_TO_THE_63)
+    return new_term(TERM_ADD, x, bv_const(d), 0);
+  else
+    return new_term(TERM_SUB, x, bv_const(-d), 0);
+}
+
+uint64_t bv_const(uint64_t value) { return new_term(TERM_CONST, 0, 0, value); }
+uint64_t bv_input(uint64_t index) { return new_term(TERM_INPUT, 0, 0, index); }
+uint64_t bv_read(uint64_t index)  { return new_term(TERM_READ,  0, 0, index); }
+uint64_t bv_param(uint64_t index) { return new_term(TERM_PARAM, 0, 0, index); }
+
+uint64_t bv_add(uint64_t a, uint64_t b) {
+  if (is_constant(a)) {
+    if (is_constant(b))
+      return fold(TERM_ADD, a, b);
+
+    return bv_offset(b, term_values[a]);
+  } else if (is_constant(b))
+    return bv_offset(a, term_values[b]);
+
+  return new_term(TERM_ADD, a, b, 0);
+}
+
+uint64_t bv_sub(uint64_t a, uint64_t b) {
+  if (is_constant(b)) {
+    if (is_constant(a))
+      return fold(TERM_SUB, a, b);
+
+    return bv_offset(a, -term_values[b]);
+  } else if (a == b)
+    return bv_const(0);
+
+  return new_term(TERM_SUB, a, b, 0);
+}
+
+uint64_t bv_mul(uint64_t a, uint64_t b) {
+  uint64_t c;
+
+  // constants go right
+  if (is_constant(a)) {
+    c = a;
+    a = b;
+    b = c;
+  }
+
+  if (is_constant(b)) {
+    if (is_constant(a))
+      return fold(TERM_MUL, a, b);
+    else if (term_values[b] == 0)
+      return b;
+    else if (term_values[b] == 1)
+      return a;
+    else if (term_ops[a] == TERM_MUL)
+      if (is_constant(term_rights[a]))
+        return bv_mul(term_lefts[a], bv_const(term_values[term_rights[a]] * term_values[b]));
+  }
+
+  return new_term(TERM_MUL, a, b, 0);
+}
+
+uint64_t bv_udiv(uint64_t a, uint64_t b) {
+  if (is_constant(b)) {
+    if (is_constant(a))
+      return fold(TERM_UDIV, a, b);
+    else if (term_values[b] == 1)
+      return a;
+  }
+
+  return new_term(TERM_UDIV, a, b, 0);
+}
+
+uint64_t bv_urem(uint64_t a, uint64_t b) {
+  if (is_constant(b)) {
+    if (is_constant(a))
+      return fold(TERM_UREM, a, b);
+    else if (term_values[b] == 1)
+      return bv_const(0);
+  }
+
+  return new_term(TERM_UREM, a, b, 0);
+}
+
+// comparisons are never folded since backends need them as formulas
+uint64_t bv_ult(uint64_t a, uint64_t b) { return new_term(TERM_ULT, a, b, 0); }
+uint64_t bv_uge(uint64_t a, uint64_t b) { return new_term(TERM_UGE, a, b, 0); }
+uint64_t bv_ule(uint64_t a, uint64_t b) { return new_term(TERM_ULE, a, b, 0); }
+uint64_t bv_eq(uint64_t a, uint64_t b)  { return new_term(TERM_EQ,  a, b, 0); }
+
+uint64_t bv_ite(uint64_t c, uint64_t a, uint64_t b) {
+  if (a == b)
+    return a;
+
+  return new_term(TERM_ITE, a, b, c);
+}
+
+uint64_t bv_apply(uint8_t op, uint64_t a, uint64_t b) {
+  if (op == TERM_ADD)
+    return bv_add(a, b);
+  else if (op == TERM_SUB)
+    return bv_sub(a, b);
+  else if (op == TERM_MUL)
+    return bv_mul(a, b);
+  else if (op == TERM_UDIV)
+    return bv_udiv(a, b);
+  else if (op == TERM_UREM)
+    return bv_urem(a, b);
+  else if (op == TERM_ULT)
+    return bv_ult(a, b);
+  else if (op == TERM_UGE)
+    return bv_uge(a, b);
+  else if (op == TERM_ULE)
+    return bv_ule(a, b);
+  else
+    return bv_eq(a, b);
+}
+
+// rebuilds t bottom-up with every term found in done replaced by its
+// entry. done is seeded with the replacements and keeps the rebuilt
+// terms, so that it may be shared among several terms
+uint64_t substitute(uint64_t t, std::unordered_map<uint64_t, uint64_t>& done) {
+  std::vector<uint64_t> stack;
+  uint64_t n;
+  uint8_t  op;
+
+  stack.push_back(t);
+
+  while (stack.empty() == 0) {
+    n  = stack.back();
+    op = term_ops[n];
+
+    if (done.count(n))
+      stack.pop_back();
+    else if (op <= TERM_READ || op == TERM_PARAM) {
+      done[n] = n;
+      stack.pop_back();
+    } else if (done.count(term_lefts[n]) == 0)
+      stack.push_back(term_lefts[n]);
+    else if (done.count(term_rights[n]) == 0)
+      stack.push_back(term_rights[n]);
+    else if (op == TERM_ITE) {
+      if (done.count(term_values[n]) == 0)
+        stack.push_back(term_values[n]);
+      else {
+        done[n] = bv_ite(done[term_values[n]], done[term_lefts[n]], done[term_rights[n]]);
+        stack.pop_back();
+      }
+    } else {
+      done[n] = bv_apply(op, done[term_lefts[n]], done[term_rights[n]]);
+      stack.pop_back();
+    }
+  }
+
+  return done[t];
+}
+
+void translate_term(void* instance, uint64_t t, uint64_t (*is_translated)(void*, uint64_t), void (*translate_node)(void*, uint64_t)) {
+  std::vector<uint64_t> stack;
+  uint64_t n;
+  uint64_t l;
+  uint64_t r;
+
+  // symbolic loops build long operand chains, so avoid recursion
+  stack.push_back(t);
+
+  while (stack.empty() == 0) {
+    n = stack.back();
+
+    if (is_translated(instance, n))
+      stack.pop_back();
+    else if (term_ops[n] <= TERM_READ) {
+      translate_node(instance, n);
+      stack.pop_back();
+    } else {
+      l = term_lefts[n];
+      r = term_rights[n];
+
+      if (is_translated(instance, l) == 0)
+        stack.push_back(l);
+      else if (is_translated(instance, r) == 0)
+        stack.push_back(r);
+      else if (term_ops[n] == TERM_ITE && is_translated(instance, term_values[n]) == 0)
+        stack.push_back(term_values[n]);
+      else {
+        translate_node(instance, n);
+        stack.pop_back();
+      }
+    }
+  }
+}
+
+uint64_t evaluate_with(uint64_t t, solver_model* model, std::unordered_map<uint64_t, uint64_t>& values) {
+  std::vector<uint64_t> stack;
+  solver_model::iterator it;
+  uint64_t n;
+  uint8_t  op;
+
+  stack.push_back(t);
+
+  while (stack.empty() == 0) {
+    n  = stack.back();
+    op = term_ops[n];
+
+    if (values.count(n))
+      stack.pop_back();
+    else if (op == TERM_CONST) {
+      values[n] = term_values[n];
+      stack.pop_back();
+    } else if (op <= TERM_READ) {
+      it = model->find(variable_key(n));
+
+      if (it != model->end())
+        values[n] = it->second;
+      else
+        values[n] = 0;
+
+      stack.pop_back();
+    } else if (values.count(term_lefts[n]) == 0)
+      stack.push_back(term_lefts[n]);
+    else if (values.count(term_rights[n]) == 0)
+      stack.push_back(term_rights[n]);
+    else if (op == TERM_ITE) {
+      if (values.count(term_values[n]) == 0)
+        stack.push_back(term_values[n]);
+      else {
+        if (values[term_values[n]])
+          values[n] = values[term_lefts[n]];
+        else
+          values[n] = values[term_rights[n]];
+
+        stack.pop_back();
+      }
+    } else {
+      values[n] = apply_op(op, values[term_lefts[n]], values[term_rights[n]]);
+      stack.pop_back();
+    }
+  }
+
+  return values[t];
+}
+
+uint64_t evaluate_term(uint64_t t, solver_model* model) {
+  std::unordered_map<uint64_t, uint64_t> values;
+
+  return evaluate_with(t, model, values);
+}
+
+uint64_t satisfies(solver_model* model, std::vector<uint64_t>* terms, uint64_t from) {
+  std::unordered_map<uint64_t, uint64_t> values; // shared among all terms
+
+  while (from < terms->size()) {
+    if (evaluate_with((*terms)[from], model, values) == 0)
+      return 0;
+
+    from = from + 1;
+  }
+
+  return 1;
+}
+
+void collect_variables(std::vector<uint64_t>* terms, std::vector<uint64_t>* variables) {
+  std::unordered_map<uint64_t, uint64_t> visited;
+  std::vector<uint64_t> stack;
+  uint64_t n;
+
+  stack = *terms;
+
+  while (stack.empty() == 0) {
+    n = stack.back();
+    stack.pop_back();
+
+    if (visited.count(n) == 0) {
+      visited[n] = 1;
+
+      if (is_variable(n))
+        variables->push_back(n);
+      else if (term_ops[n] > TERM_READ && term_ops[n] != TERM_PARAM) {
+        stack.push_back(term_lefts[n]);
+        stack.push_back(term_rights[n]);
+
+        if (term_ops[n] == TERM_ITE)
+          stack.push_back(term_values[n]);
+      }
+    }
+  }
+}
+
+uint64_t binary_string_to_uint64(const char* s) {
+  uint64_t value = 0;
+
+  while (*s == '0' || *s == '1') {
+    value = 2 * value + (*s - '0');
+    s++;
+  }
+
+  return value;
+}
+
+// -----------------------------------------------------------------
+// ------------------------ SOLVER BACKENDS ------------------------
+// -----------------------------------------------------------------
+
+uint64_t SOLVER_UNSAT   = 0;
+uint64_t SOLVER_SAT     = 1;
+uint64_t SOLVER_UNKNOWN = 2;
+
+#ifdef SASE_Z3
+extern solver_backend z3_backend;
+#endif
+#ifdef SASE_CVC4
+extern solver_backend cvc4_backend;
+#endif
+#ifdef SASE_BOOLECTOR
+extern solver_backend boolector_backend;
+#endif
+
+// backends compiled into phantom, the first one is the default
+solver_backend* backends[] = {
+#ifdef SASE_Z3
+  &z3_backend,
+#endif
+#ifdef SASE_CVC4
+  &cvc4_backend,
+#endif
+#ifdef SASE_BOOLECTOR
+  &boolector_backend,
+#endif
+  0
+};
+
+thread_local solver_backend* backend = 0; // the first of backends unless selected
+thread_local void*           slv     = 0;
+
+thread_local std::vector<uint64_t> asserted;
+thread_local std::vector<uint64_t> asserted_scopes;
+thread_local std::vector<uint64_t> term_scopes; // number of terms at every open push
+
+thread_local uint64_t use_model_reuse = 1;
+thread_local uint64_t use_assumptions = 0;
+
+thread_local std::vector<uint8_t> guarded; // constraints asserted with activation literal
+
+thread_local uint64_t number_of_guarded     = 0;
+thread_local uint64_t number_of_recreations = 0;
+
+thread_local solver_model last_model;           // model of the most recent sat check
+thread_local uint64_t     has_last_model   = 0;
+thread_local uint64_t     last_model_valid = 0; // asserted constraints below are satisfied by last_model
+
+thread_local solver_model* cached_model = 0; // model of the last check if not answered by the backend
+
+thread_local const char* answered_by = ""; // model reuse, query cache or the backend name
+
+thread_local uint64_t has_core = 0; // the most recent check was unsat with assumptions
+
+thread_local uint64_t number_of_queries       = 0;
+thread_local uint64_t number_of_reused_models = 0;
+
+thread_local uint64_t solver_timeout  = 0;
+thread_local uint64_t solver_deadline = 0;
+
+thread_local uint64_t backend_timeout = 0; // limit most recently set in the backend
+
+thread_local uint64_t number_of_unknowns = 0;
+
+thread_local uint64_t last_check_microseconds = 0;
+
+void print_solvers() {
+  uint64_t i = 0;
+
+  while (backends[i] != 0) {
+    if (i > 0)
+      printf("|");
+    printf("%s", backends[i]->name);
+
+    i = i + 1;
+  }
+}
+
+solver_backend* find_solver(char* name) {
+  uint64_t i = 0;
+
+  while (backends[i] != 0) {
+    if (strcmp(backends[i]->name, name) == 0)
+      return backends[i];
+
+    i = i + 1;
+  }
+
+  printf("unknown solver %s, available: ", name);
+  print_solvers();
+  printf("\n");
+
+  exit_explorer(EXITCODE_BADARGUMENTS);
+}
+
+void select_solver(char* name) {
+  backend = find_solver(name);
+}
+
+const char* profiles[] = { "default", "qfbv", "light", 0 };
+
+thread_local const char* solver_profile = 0; // chosen by init_solver unless selected
+
+void print_profiles() {
+  uint64_t i = 0;
+
+  while (profiles[i] != 0) {
+    if (i > 0)
+      printf("|");
+    printf("%s", profiles[i]);
+
+    i = i + 1;
+  }
+}
+
+void select_profile(char* name) {
+  uint64_t i = 0;
+
+  while (profiles[i] != 0) {
+    if (strcmp(profiles[i], name) == 0) {
+      solver_profile = profiles[i];
+
+      return;
+    }
+
+    i = i + 1;
+  }
+
+  printf("unknown solver profile %s, available: ", name);
+  print_profiles();
+  printf("\n");
+
+  exit_explorer(EXITCODE_BADARGUMENTS);
+}
+
+void init_solver() {
+  if (backend == 0)
+    backend = backends[0];
+
+  if (backend == 0) {
+    printf("%s\n", "no solver backend compiled into phantom");
+
+    exit_explorer(EXITCODE_BADARGUMENTS);
+  }
+
+  if (use_assumptions)
+    if (backend->assert_guarded == 0) {
+      printf("solver %s does not support assumptions\n", backend->name);
+
+      exit_explorer(EXITCODE_BADARGUMENTS);
+    }
+
+  // the fastest profile measured for the mode, qfbv is slow with
+  // assumptions, see the README
+  if (solver_profile == 0) {
+    if (use_assumptions)
+      solver_profile = "default";
+    else
+      solver_profile = "qfbv";
+  }
+
+  slv = backend->create();
+}
+
+// with slicing the backend only sees the constraints of each query,
+// with assumptions it holds every constraint ever asserted, guarded,
+// otherwise it holds all asserted constraints incrementally
+
+uint64_t backend_holds_assertions() {
+  return use_slicing + use_assumptions == 0;
+}
+
+void solver_push() {
+  asserted_scopes.push_back(asserted.size());
+  term_scopes.push_back(number_of_terms);
+
+  interval_push();
+
+  if (use_slicing)
+    slicing_push();
+
+  if (backend_holds_assertions())
+    backend->push(slv);
+}
+
+void solver_pop() {
+  asserted.resize(asserted_scopes.back());
+  asserted_scopes.pop_back();
+
+  if (last_model_valid > asserted.size())
+    last_model_valid = asserted.size();
+
+  interval_pop();
+
+  if (use_slicing)
+    slicing_pop();
+
+  if (backend_holds_assertions())
+    backend->pop(slv);
+
+  // terms created since the push belong to the abandoned path, the
+  // backend translates them again if they ever come back
+  if (backend->release != 0)
+    backend->release(slv, term_scopes.back());
+
+  term_scopes.pop_back();
+}
+
+// forgets every constraint, also those asserted outside of any push,
+// when the engine restarts the program. only used if the backend
+// does not hold the assertions itself
+void solver_reset() {
+  while (asserted_scopes.size() > 0)
+    solver_pop();
+
+  asserted.clear();
+
+  last_model_valid = 0;
+
+  interval_reset();
+
+  if (use_slicing)
+    slicing_reset();
+}
+
+void solver_assert(uint64_t t) {
+  asserted.push_back(t);
+
+  if (use_intervals)
+    interval_assert(t);
+
+  if (use_slicing)
+    slicing_assert(t, asserted.size() - 1);
+
+  if (backend_holds_assertions())
+    backend->assert_formula(slv, t);
+}
+
+void remember_model(solver_model* model, std::vector<uint64_t>* query) {
+  std::vector<uint64_t> variables;
+  solver_model::iterator it;
+  uint64_t i = 0;
+
+  // only variables of the query are taken over, the values of all
+  // other variables still satisfy the constraints outside the query
+  collect_variables(query, &variables);
+
+  while (i < variables.size()) {
+    it = model->find(variable_key(variables[i]));
+
+    if (it != model->end())
+      last_model[variable_key(variables[i])] = it->second;
+    else
+      last_model[variable_key(variables[i])] = 0;
+
+    i = i + 1;
+  }
+
+  has_last_model   = 1;
+  last_model_valid = asserted.size();
+}
+
+void guard_constraints(std::vector<uint64_t>* constraints) {
+  uint64_t i = 0;
+  uint64_t t;
+
+  if (guarded.size() < number_of_terms)
+    guarded.resize(number_of_terms, 0);
+
+  while (i < constraints->size()) {
+    t = (*constraints)[i];
+
+    if (guarded[t] == 0) {
+      backend->assert_guarded(slv, t);
+
+      guarded[t] = 1;
+
+      number_of_guarded = number_of_guarded + 1;
+    }
+
+    i = i + 1;
+  }
+}
+
+// with assumptions the instance keeps a_t => t of every constraint
+// ever guarded, also of subtrees explored long ago. once those are
+// twice the constraints of the current path, a new instance which
+// only guards what is queried from then on is cheaper
+void recreate_guarded_instance() {
+  if (backend->destroy == 0)
+    return;
+
+  if (number_of_guarded < 64)
+    return;
+  else if (number_of_guarded < 2 * asserted.size())
+    return;
+
+  backend->destroy(slv);
+
+  slv = backend->create();
+
+  guarded.clear();
+
+  number_of_guarded = 0;
+
+  // the new instance has no limit, see limit_check
+  backend_timeout = 0;
+
+  number_of_recreations = number_of_recreations + 1;
+}
+
+uint64_t wall_clock_microseconds() {
+  struct timespec now;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+
+  return (uint64_t) now.tv_sec * 1000000 + (uint64_t) now.tv_nsec / 1000;
+}
+
+uint64_t wall_clock_milliseconds() {
+  return wall_clock_microseconds() / 1000;
+}
+
+// limits the next check to the timeout and the time left until the
+// deadline, returns 0 if the deadline has passed already
+uint64_t limit_check() {
+  uint64_t limit = solver_timeout;
+  uint64_t now;
+
+  if (solver_deadline != 0) {
+    now = wall_clock_milliseconds();
+
+    if (now >= solver_deadline)
+      return 0;
+
+    if (limit == 0)
+      limit = solver_deadline - now;
+    else if (solver_deadline - now < limit)
+      limit = solver_deadline - now;
+  }
+
+  if (limit != backend_timeout)
+    if (backend->set_timeout != 0) {
+      backend->set_timeout(slv, limit);
+
+      backend_timeout = limit;
+    }
+
+  return 1;
+}
+
+uint64_t check_query(std::vector<uint64_t>* query, solver_model* model) {
+  std::vector<uint64_t> variables;
+  std::vector<uint64_t> bounds;
+  uint64_t width = 64;
+  uint64_t result;
+  uint64_t i;
+
+  if (use_assumptions)
+    recreate_guarded_instance();
+
+  if (limit_check() == 0)
+    return SOLVER_UNKNOWN;
+
+  if (use_assumptions) {
+    guard_constraints(query);
+
+    result = backend->check_assuming(slv, query);
+
+    if (result == SOLVER_UNSAT)
+      if (backend->get_core != 0)
+        has_core = 1;
+  } else {
+    if (use_slicing) {
+      // only a query sent on its own can be encoded at another width
+      if (use_width_reduction)
+        if (use_intervals)
+          if (backend->set_width != 0)
+            width = query_width(query, &bounds);
+
+      backend->push(slv);
+
+      if (width < 64) {
+        backend->set_width(slv, width);
+
+        i = 0;
+
+        while (i < bounds.size()) {
+          backend->assert_formula(slv, bounds[i]);
+
+          i = i + 1;
+        }
+      }
+
+      i = 0;
+
+      while (i < query->size()) {
+        backend->assert_formula(slv, (*query)[i]);
+
+        i = i + 1;
+      }
+    }
+
+    result = backend->check(slv);
+  }
+
+  if (result == SOLVER_SAT)
+    if (use_model_reuse + use_query_cache + use_slicing > 0) {
+      collect_variables(query, &variables);
+
+      i = 0;
+
+      while (i < variables.size()) {
+        (*model)[variable_key(variables[i])] = backend->get_value(slv, variables[i]);
+
+        i = i + 1;
+      }
+    }
+
+  if (use_slicing)
+    if (use_assumptions == 0)
+      backend->pop(slv);
+
+  if (width < 64)
+    backend->set_width(slv, 64);
+
+  return result;
+}
+
+uint64_t decide_query() {
+  std::vector<uint64_t> query;
+  solver_model          model;
+  solver_model*         hit;
+  uint64_t              result;
+
+  cached_model = 0;
+
+  has_core = 0;
+
+  if (use_model_reuse)
+    if (has_last_model)
+      if (satisfies(&last_model, &asserted, last_model_valid)) {
+        number_of_reused_models = number_of_reused_models + 1;
+
+        last_model_valid = asserted.size();
+
+        cached_model = &last_model;
+
+        answered_by = "model reuse";
+
+        return SOLVER_SAT;
+      }
+
+  if (use_slicing)
+    slice_constraints(&asserted, last_model_valid, &query);
+  else
+    query = asserted;
+
+  if (use_query_cache) {
+    result = query_cache_lookup(&query, &hit);
+
+    if (result == SOLVER_SAT) {
+      remember_model(hit, &query);
+
+      cached_model = &last_model;
+    }
+
+    if (result != SOLVER_UNKNOWN) {
+      answered_by = "query cache";
+
+      return result;
+    }
+  }
+
+  answered_by = backend->name;
+
+  result = check_query(&query, &model);
+
+  if (result == SOLVER_UNKNOWN)
+    number_of_unknowns = number_of_unknowns + 1;
+
+  if (result == SOLVER_SAT)
+    if (use_model_reuse + use_query_cache + use_slicing > 0) {
+      remember_model(&model, &query);
+
+      // the backend has forgotten the sliced query already
+      if (use_slicing)
+        cached_model = &last_model;
+    }
+
+  if (use_query_cache)
+    if (result != SOLVER_UNKNOWN)
+      query_cache_insert(&query, result, &model);
+
+  return result;
+}
+
+uint64_t solver_check() {
+  uint64_t start;
+  uint64_t result;
+
+  number_of_queries = number_of_queries + 1;
+
+  start = wall_clock_microseconds();
+
+  result = decide_query();
+
+  last_check_microseconds = wall_clock_microseconds() - start;
+
+  if (dump_directory != 0)
+    dump_query(&asserted, result, last_check_microseconds, answered_by);
+
+  return result;
+}
+
+// the bounds of width reduction are derived from all asserted
+// constraints, not only from the prefix, so there is no reduction
+uint64_t solver_check_prefix(uint64_t length) {
+  std::vector<uint64_t> rest;
+  uint64_t saved_width_reduction = use_width_reduction;
+  uint64_t result;
+
+  rest.assign(asserted.begin() + length, asserted.end());
+
+  asserted.resize(length);
+
+  if (last_model_valid > length)
+    last_model_valid = length;
+
+  use_width_reduction = 0;
+
+  result = solver_check();
+
+  use_width_reduction = saved_width_reduction;
+
+  asserted.insert(asserted.end(), rest.begin(), rest.end());
+
+  return result;
+}
+
+uint64_t solver_core_bound() {
+  std::vector<uint64_t> core;
+  std::unordered_map<uint64_t, uint64_t> in_core;
+  uint64_t i = 0;
+
+  if (has_core == 0)
+    return asserted.size() - 1;
+
+  backend->get_core(slv, &core);
+
+  // a backend which does not track assumptions returns no core
+  if (core.empty())
+    return asserted.size() - 1;
+
+  while (i < core.size()) {
+    in_core[core[i]] = 1;
+
+    i = i + 1;
+  }
+
+  // a constraint asserted more than once is in the core from its
+  // first position on
+  i = 0;
+
+  while (i < asserted.size()) {
+    if (in_core.count(asserted[i]))
+      in_core.erase(asserted[i]);
+
+    if (in_core.empty())
+      return i;
+
+    i = i + 1;
+  }
+
+  return asserted.size() - 1;
+}
+
+uint64_t solver_get_value(uint64_t t) {
+  if (cached_model != 0)
+    return evaluate_term(t, cached_model);
+
+  return backend->get_value(slv, t);
+}
+
+void solver_print_model() {
+  uint64_t i = 0;
+
+  // the backend has not seen the query if it was answered otherwise
+  if (use_assumptions) {
+    guard_constraints(&asserted);
+
+    backend->check_assuming(slv, &asserted);
+    backend->print_model(slv);
+
+    return;
+  } else if (use_slicing) {
+    backend->push(slv);
+
+    while (i < asserted.size()) {
+      backend->assert_formula(slv, asserted[i]);
+
+      i = i + 1;
+    }
+
+    backend->check(slv);
+    backend->print_model(slv);
+    backend->pop(slv);
+
+    return;
+  } else if (cached_model != 0)
+    backend->check(slv);
+
+  backend->print_model(slv);
+}
+
+void solver_print_statistics() {
+  printf("terms: %llu created, %llu shared, %llu folded\n",
+    (unsigned long long) number_of_terms - 1,
+    (unsigned long long) number_of_shared_terms,
+    (unsigned long long) number_of_folded_terms);
+
+  if (use_slicing)
+    print_slicing_statistics();
+
+  if (use_width_reduction)
+    print_width_statistics();
+
+  if (use_query_cache)
+    query_cache_print_statistics();
+
+  if (backend->print_statistics != 0)
+    backend->print_statistics(slv);
+}
@@ -0,0 +1,295 @@
+/*
+  This project contains part of the Selfie Project source code
+  which is governed by a BSD license. For further information
+  and LICENSE conditions see the following website:
+  http://selfie.cs.uni-salzburg.at
+
+  The solver interface hides the api of the SMT solvers
+  (z3, cvc4, boolector) behind engine-owned terms so that
+  the backend can be selected at runtime.
+*/
+
+#include <stdint.h>
+#include <vector>
+#include <unordered_map>
+
+// -----------------------------------------------------------------
+// ------------------------- SOLVER TERMS --------------------------
+// -----------------------------------------------------------------
+
+// terms are created and owned by the engine and referred to by their
+// index in the term table. backends translate terms into native
+// expressions only when a term is asserted or queried.
+//
+// terms are hash-consed, so structurally equal terms share one index.
+// the constructors fold constant operands and keep sums in affine
+// normal form, e.g. (x + 8) + 8 becomes x + 16.
+//
+// term struct (column-wise):
+// +---+-------+--------------------------------------------+
+// | 0 | op    | TERM_CONST, TERM_INPUT, TERM_READ, TERM_ADD |
+// | 1 | left  | first operand                               |
+// | 2 | right | second operand                              |
+// | 3 | value | constant value or variable index            |
+// | 4 | hash  | structural hash of the term                 |
+// +---+-------+--------------------------------------------+
+
+extern uint8_t TERM_CONST;
+extern uint8_t TERM_INPUT; // variable in_N of symbolic input
+extern uint8_t TERM_READ;  // variable rv_N of read call
+extern uint8_t TERM_ADD;
+extern uint8_t TERM_SUB;
+extern uint8_t TERM_MUL;
+extern uint8_t TERM_UDIV;
+extern uint8_t TERM_UREM;
+extern uint8_t TERM_ULT;
+extern uint8_t TERM_UGE;
+extern uint8_t TERM_ULE;
+extern uint8_t TERM_EQ;
+extern uint8_t TERM_ITE;   // if-then-else, the condition is kept as value
+extern uint8_t TERM_PARAM; // parameter of a function summary, never seen by a backend
+
+extern thread_local uint8_t*  term_ops;
+extern thread_local uint64_t* term_lefts;
+extern thread_local uint64_t* term_rights;
+extern thread_local uint64_t* term_values;
+extern thread_local uint64_t* term_hashes;
+extern thread_local uint64_t  number_of_terms;
+
+uint8_t  get_term_op(uint64_t t);
+uint64_t get_term_left(uint64_t t);
+uint64_t get_term_right(uint64_t t);
+uint64_t get_term_value(uint64_t t);
+uint64_t get_term_hash(uint64_t t);
+
+uint64_t mix_hash(uint64_t h, uint64_t v);
+
+uint64_t is_variable(uint64_t t);
+char*    variable_name(uint64_t t);
+uint64_t variable_key(uint64_t t); // unique among in_N and rv_N
+
+// name of the variable in a query encoded at fewer than 64 bits, e.g. in_N_w8
+char*    variable_name_at(uint64_t t, uint64_t width);
+uint64_t value_at(uint64_t value, uint64_t width); // lowest width bits of value
+
+uint64_t bv_const(uint64_t value);
+uint64_t bv_input(uint64_t index);
+uint64_t bv_read(uint64_t index);
+uint64_t bv_param(uint64_t index);
+uint64_t bv_add(uint64_t a, uint64_t b);
+uint64_t bv_sub(uint64_t a, uint64_t b);
+uint64_t bv_mul(uint64_t a, uint64_t b);
+uint64_t bv_udiv(uint64_t a, uint64_t b);
+uint64_t bv_urem(uint64_t a, uint64_t b);
+uint64_t bv_ult(uint64_t a, uint64_t b);
+uint64_t bv_uge(uint64_t a, uint64_t b);
+uint64_t bv_ule(uint64_t a, uint64_t b);
+uint64_t bv_eq(uint64_t a, uint64_t b);
+uint64_t bv_ite(uint64_t c, uint64_t a, uint64_t b); // a if comparison c holds, b otherwise
+uint64_t bv_apply(uint8_t op, uint64_t a, uint64_t b);  // any binary operator but ite
+
+uint64_t substitute(uint64_t t, std::unordered_map<uint64_t, uint64_t>& done);
+
+// a model maps the variable key of in_N and rv_N to its value,
+// variables without a value are zero
+typedef std::unordered_map<uint64_t, uint64_t> solver_model;
+
+uint64_t evaluate_term(uint64_t t, solver_model* model);
+uint64_t satisfies(solver_model* model, std::vector<uint64_t>* terms, uint64_t from);
+
+void collect_variables(std::vector<uint64_t>* terms, std::vector<uint64_t>* variables);
+
+// -----------------------------------------------------------------
+// ------------------------ SOLVER BACKENDS ------------------------
+// -----------------------------------------------------------------
+
+extern uint64_t SOLVER_UNSAT;
+extern uint64_t SOLVER_SAT;
+extern uint64_t SOLVER_UNKNOWN;
+
+// every backend provides its own solver instances
+struct solver_backend {
+  const char* name;
+  void*    (*create)();
+  void     (*push)(void* instance);
+  void     (*pop)(void* instance);
+  void     (*assert_formula)(void* instance, uint64_t t);
+  uint64_t (*check)(void* instance);
+  void     (*assert_guarded)(void* instance, uint64_t t); // asserts a_t => t with a fresh literal a_t
+  uint64_t (*check_assuming)(void* instance, std::vector<uint64_t>* ts); // check assuming a_t for all t in ts
+  void     (*get_core)(void* instance, std::vector<uint64_t>* ts); // t of all a_t in the unsat core of check_assuming
+  uint64_t (*get_value)(void* instance, uint64_t t); // value of t in the most recent model
+  void     (*print_model)(void* instance);
+  void     (*interrupt)(void* instance);        // may be called from another thread, 0 if unsupported
+  void     (*set_timeout)(void* instance, uint64_t milliseconds); // limits the following checks, 0 for no limit
+  void     (*set_width)(void* instance, uint64_t width); // bit width of following translations, 0 if only 64 bits
+  void     (*release)(void* instance, uint64_t first);   // drops translations of terms from first on, 0 if kept
+  void     (*print_statistics)(void* instance); // 0 if there is nothing to report
+  void     (*destroy)(void* instance);          // frees the instance, 0 if it cannot be replaced
+};
+
+extern thread_local solver_backend* backend; // selected backend
+extern thread_local void*           slv;     // solver instance of selected backend
+
+solver_backend* find_solver(char* name);
+void            select_solver(char* name);
+void            print_solvers();
+
+// races the backends listed in names, e.g. "z3,boolector", on every check
+extern thread_local solver_backend portfolio_backend;
+
+void select_portfolio(char* names);
+
+// named configurations which every backend applies to its instances:
+// default leaves the backend as it is, qfbv selects its quantifier-free
+// bit-vector solver, light bit-blasts with little preprocessing.
+// without a selection qfbv is used with push and pop, default with
+// assumptions
+extern thread_local const char* solver_profile;
+
+void select_profile(char* name);
+void print_profiles();
+
+void init_solver();
+
+void     solver_push();
+void     solver_pop();
+void     solver_assert(uint64_t t);
+void     solver_reset();
+uint64_t solver_check();
+uint64_t solver_check_prefix(uint64_t length); // checks the first length asserted constraints only
+uint64_t solver_get_value(uint64_t t);
+void     solver_print_model();
+void     solver_print_statistics();
+
+// with assumptions every constraint is asserted once, guarded by its
+// own activation literal, and checks assume the literals of the
+// constraints on the current path instead of using push and pop
+extern thread_local uint64_t use_assumptions;
+
+// with assumptions the backend instance is replaced once it guards
+// many more constraints than are asserted, see recreate_guarded_instance
+extern thread_local uint64_t number_of_recreations;
+
+// constraints currently asserted and the size of the assertion
+// stack at every open push
+extern thread_local std::vector<uint64_t> asserted;
+extern thread_local std::vector<uint64_t> asserted_scopes;
+
+// a check is skipped if the model of the most recent sat check
+// also satisfies the constraints asserted since then
+extern thread_local uint64_t use_model_reuse;
+
+extern thread_local uint64_t number_of_queries;
+extern thread_local uint64_t number_of_reused_models;
+
+extern thread_local uint64_t last_check_microseconds; // time of the most recent solver_check
+
+// position in asserted of the latest constraint in the unsat core of
+// the most recent check. cores are only known with assumptions, in
+// all other cases this is the position of the last asserted constraint
+uint64_t solver_core_bound();
+
+// the backend holds the asserted constraints themselves, so checks
+// cannot leave out any of them
+uint64_t backend_holds_assertions();
+
+// -----------------------------------------------------------------
+// ------------------------- SOLVER TIMEOUTS -----------------------
+// -----------------------------------------------------------------
+
+// every check is limited to solver_timeout milliseconds and has to end
+// before solver_deadline, a wall-clock time in milliseconds, 0 for none.
+// checks which run out of time are unknown
+extern thread_local uint64_t solver_timeout;
+extern thread_local uint64_t solver_deadline;
+
+extern thread_local uint64_t number_of_unknowns;
+
+uint64_t wall_clock_milliseconds();
+uint64_t wall_clock_microseconds();
+
+// -----------------------------------------------------------------
+// ------------------------ CONSTRAINT SLICING ---------------------
+// -----------------------------------------------------------------
+
+extern thread_local uint64_t use_slicing;
+
+// collects the constraints from position from on together with all
+// constraints which share variables with them, directly or indirectly
+void slice_constraints(std::vector<uint64_t>* constraints, uint64_t from, std::vector<uint64_t>* slice);
+
+// the variables shared by asserted constraints are tracked as they are
+// asserted, position is the index of c among the asserted constraints
+void slicing_push();
+void slicing_pop();
+void slicing_reset();
+void slicing_assert(uint64_t c, uint64_t position);
+std::vector<uint64_t>* variables_of(uint64_t c); // variable keys of a constraint, memoized
+void print_slicing_statistics();
+
+// -----------------------------------------------------------------
+// ------------------------ INTERVAL DOMAIN ------------------------
+// -----------------------------------------------------------------
+
+extern thread_local uint64_t use_intervals;
+
+void interval_push();
+void interval_pop();
+void interval_reset();
+void interval_assert(uint64_t t);
+
+// returns 1 and sets result if a < b holds for all or for no values
+// within the current intervals, returns 0 otherwise
+uint64_t decide_ult(uint64_t a, uint64_t b, uint64_t* result);
+
+// with width reduction, a sliced query whose variables are bounded is
+// encoded at the smallest width at which operands of comparisons and
+// divisions cannot wrap around. additions, subtractions and
+// multiplications are exact modulo any width. the intervals of the
+// variables are asserted along with the query at that width
+extern thread_local uint64_t use_width_reduction;
+
+// returns the width of query, 64 if it cannot be reduced, and collects
+// the interval constraints of its variables in bounds
+uint64_t query_width(std::vector<uint64_t>* query, std::vector<uint64_t>* bounds);
+void     print_width_statistics();
+
+// -----------------------------------------------------------------
+// ------------------------- QUERY CACHE ---------------------------
+// -----------------------------------------------------------------
+
+extern thread_local uint64_t use_query_cache;
+
+// looks up the canonical set of asserted constraints and returns
+// SOLVER_UNKNOWN on a miss, on a sat hit the model is stored in model
+uint64_t query_cache_lookup(std::vector<uint64_t>* constraints, solver_model** model);
+void     query_cache_insert(std::vector<uint64_t>* constraints, uint64_t result, solver_model* model);
+void     query_cache_print_statistics();
+
+// -----------------------------------------------------------------
+// ------------------------- QUERY DUMPS ---------------------------
+// -----------------------------------------------------------------
+
+// with a dump directory every check is written into it as a
+// self-contained SMT-LIB2 file query_N.smt2 together with its outcome,
+// its time and what answered it. the replay tool reads these files
+extern thread_local char* dump_directory;
+
+// workers of -jobs dump into files of their own, query_W_N.smt2
+extern thread_local uint64_t dump_worker;
+
+void dump_query(std::vector<uint64_t>* constraints, uint64_t result, uint64_t microseconds, const char* answered_by);
+
+const char* result_name(uint64_t result); // sat, unsat or unknown
+
+// post-order traversal of t shared by all backends: translate_node is
+// called on every subterm of t which is not yet translated
+void translate_term(void* instance, uint64_t t, uint64_t (*is_translated)(void*, uint64_t), void (*translate_node)(void*, uint64_t));
+
+uint64_t binary_string_to_uint64(const char* s);
+
+// ends the explorer on the calling thread with code, or the process
+// if it explores alone. defined by phantom, see run_explorers, and by
+// the replay tool which always runs alone
+[[noreturn]] void exit_explorer(uint64_t code);
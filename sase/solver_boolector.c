@@ -0,0 +1,363 @@
+/*
+  This project contains part of the Selfie Project source code
+  which is governed by a BSD license. For further information
+  and LICENSE conditions see the following website:
+  http://selfie.cs.uni-salzburg.at
+
+  Furthermore this project uses the api of boolector SMT solver
+  further information: boolector.github.io
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+#include <unordered_map>
+extern "C" {
+#include "boolector.h"
+}
+#include "solver.h"
+
+struct boolector_solver {
+  Btor*                       btor;
+  std::vector<BoolectorNode*> nodes; // translated terms, each holding one reference
+  std::vector<BoolectorNode*> acts;  // activation literals of guarded terms
+  std::vector<uint64_t>       assumed; // terms assumed by the most recent check
+  BoolectorSort               bool_sort;
+  volatile int32_t            terminate; // set by interrupt, polled by boolector
+  uint64_t                    timeout;   // per check in milliseconds, 0 for none
+  uint64_t                    deadline;  // of the running check, 0 for none
+  uint64_t                    width;     // of following translations
+  BoolectorSort               sorts[65]; // bit-vector sorts by width, 0 until used
+  std::unordered_map<uint64_t, BoolectorNode*> narrowed; // terms translated below 64 bits by t * 64 + width
+  uint64_t                    number_of_released;
+};
+
+BoolectorSort btor_backend_sort_of(boolector_solver* s, uint64_t width) {
+  if (s->sorts[width] == 0)
+    s->sorts[width] = boolector_bitvec_sort(s->btor, width);
+
+  return s->sorts[width];
+}
+
+BoolectorSort btor_backend_sort(boolector_solver* s) {
+  return btor_backend_sort_of(s, s->width);
+}
+
+// constants of more than 32 bits are the concatenation of their upper
+// and lower 32 bits, boolector_unsigned_int only takes 32 bits
+BoolectorNode* boolector_unsigned_int_64(boolector_solver* s, uint64_t value) {
+  BoolectorNode* upper;
+  BoolectorNode* lower;
+  BoolectorNode* e;
+
+  if (s->width <= 32)
+    return boolector_unsigned_int(s->btor, value, btor_backend_sort(s));
+
+  upper = boolector_unsigned_int(s->btor, value >> 32, btor_backend_sort_of(s, s->width - 32));
+  lower = boolector_unsigned_int(s->btor, value & 4294967295ULL, btor_backend_sort_of(s, 32));
+
+  e = boolector_concat(s->btor, upper, lower);
+
+  boolector_release(s->btor, upper);
+  boolector_release(s->btor, lower);
+
+  return e;
+}
+
+uint64_t btor_backend_is_translated(void* instance, uint64_t t) {
+  boolector_solver* s = (boolector_solver*) instance;
+
+  if (s->width < 64)
+    return s->narrowed.count(t * 64 + s->width);
+  else if (t < s->nodes.size())
+    return s->nodes[t] != 0;
+  else
+    return 0;
+}
+
+BoolectorNode* btor_backend_node(boolector_solver* s, uint64_t t) {
+  if (s->width < 64)
+    return s->narrowed[t * 64 + s->width];
+  else
+    return s->nodes[t];
+}
+
+void btor_backend_translate_node(void* instance, uint64_t t) {
+  boolector_solver* s  = (boolector_solver*) instance;
+  Btor*             btor = s->btor;
+  uint8_t           op = get_term_op(t);
+  BoolectorNode*    e;
+  BoolectorNode*    l;
+  BoolectorNode*    r;
+
+  if (op == TERM_CONST)
+    e = boolector_unsigned_int_64(s, value_at(get_term_value(t), s->width));
+  else if (is_variable(t))
+    e = boolector_var(btor, btor_backend_sort(s), variable_name_at(t, s->width));
+  else {
+    l = btor_backend_node(s, get_term_left(t));
+    r = btor_backend_node(s, get_term_right(t));
+
+    if (op == TERM_ADD)
+      e = boolector_add(btor, l, r);
+    else if (op == TERM_SUB)
+      e = boolector_sub(btor, l, r);
+    else if (op == TERM_MUL)
+      e = boolector_mul(btor, l, r);
+    else if (op == TERM_UDIV)
+      e = boolector_udiv(btor, l, r);
+    else if (op == TERM_UREM)
+      e = boolector_urem(btor, l, r);
+    else if (op == TERM_ULT)
+      e = boolector_ult(btor, l, r);
+    else if (op == TERM_UGE)
+      e = boolector_ugte(btor, l, r);
+    else if (op == TERM_ULE)
+      e = boolector_ulte(btor, l, r);
+    else if (op == TERM_ITE)
+      e = boolector_cond(btor, btor_backend_node(s, get_term_value(t)), l, r);
+    else
+      e = boolector_eq(btor, l, r);
+  }
+
+  if (s->width < 64)
+    s->narrowed[t * 64 + s->width] = e;
+  else {
+    if (t >= s->nodes.size())
+      s->nodes.resize(number_of_terms, 0);
+
+    s->nodes[t] = e;
+  }
+}
+
+BoolectorNode* btor_backend_translate(boolector_solver* s, uint64_t t) {
+  translate_term(s, t, btor_backend_is_translated, btor_backend_translate_node);
+
+  return btor_backend_node(s, t);
+}
+
+// boolector has no time limit of its own, so the terminate callback
+// also ends a check once its deadline has passed
+int32_t btor_backend_terminate(void* state) {
+  boolector_solver* s = (boolector_solver*) state;
+
+  if (s->terminate)
+    return 1;
+  else if (s->deadline != 0)
+    return wall_clock_milliseconds() >= s->deadline;
+  else
+    return 0;
+}
+
+void* btor_backend_create() {
+  boolector_solver* s = new boolector_solver();
+
+  s->btor      = boolector_new();
+  s->bool_sort = boolector_bool_sort(s->btor);
+  s->width     = 64;
+
+  boolector_set_opt(s->btor, BTOR_OPT_INCREMENTAL, 1);
+  boolector_set_opt(s->btor, BTOR_OPT_MODEL_GEN, 1);
+
+  boolector_set_term(s->btor, btor_backend_terminate, s);
+
+  // boolector only solves bit-vectors, so qfbv is its default
+  if (strcmp(solver_profile, "light") == 0)
+    boolector_set_opt(s->btor, BTOR_OPT_REWRITE_LEVEL, 1);
+
+  return s;
+}
+
+void btor_backend_push(void* instance) {
+  boolector_push(((boolector_solver*) instance)->btor, 1);
+}
+
+void btor_backend_pop(void* instance) {
+  boolector_pop(((boolector_solver*) instance)->btor, 1);
+}
+
+void btor_backend_assert_formula(void* instance, uint64_t t) {
+  boolector_solver* s = (boolector_solver*) instance;
+
+  boolector_assert(s->btor, btor_backend_translate(s, t));
+}
+
+uint64_t btor_backend_check(void* instance) {
+  boolector_solver* s = (boolector_solver*) instance;
+  int32_t           r;
+
+  s->terminate = 0;
+
+  if (s->timeout != 0)
+    s->deadline = wall_clock_milliseconds() + s->timeout;
+  else
+    s->deadline = 0;
+
+  r = boolector_sat(s->btor);
+
+  if (r == BOOLECTOR_SAT)
+    return SOLVER_SAT;
+  else if (r == BOOLECTOR_UNSAT)
+    return SOLVER_UNSAT;
+  else
+    return SOLVER_UNKNOWN;
+}
+
+void btor_backend_assert_guarded(void* instance, uint64_t t) {
+  boolector_solver* s = (boolector_solver*) instance;
+  BoolectorNode*    a;
+  BoolectorNode*    e;
+  char              name[32];
+
+  sprintf(name, "a_%llu", (unsigned long long) t);
+
+  a = boolector_var(s->btor, s->bool_sort, name);
+
+  if (t >= s->acts.size())
+    s->acts.resize(number_of_terms, 0);
+
+  s->acts[t] = a;
+
+  e = boolector_implies(s->btor, a, btor_backend_translate(s, t));
+
+  // the assertion holds its own reference
+  boolector_assert(s->btor, e);
+  boolector_release(s->btor, e);
+}
+
+uint64_t btor_backend_check_assuming(void* instance, std::vector<uint64_t>* ts) {
+  boolector_solver* s = (boolector_solver*) instance;
+  uint64_t          i = 0;
+
+  s->assumed = *ts;
+
+  // assumptions only hold for the next call of boolector_sat
+  while (i < ts->size()) {
+    boolector_assume(s->btor, s->acts[(*ts)[i]]);
+
+    i = i + 1;
+  }
+
+  return btor_backend_check(instance);
+}
+
+void btor_backend_get_core(void* instance, std::vector<uint64_t>* ts) {
+  boolector_solver* s = (boolector_solver*) instance;
+  uint64_t          i = 0;
+
+  while (i < s->assumed.size()) {
+    if (boolector_failed(s->btor, s->acts[s->assumed[i]]))
+      ts->push_back(s->assumed[i]);
+
+    i = i + 1;
+  }
+}
+
+uint64_t btor_backend_get_value(void* instance, uint64_t t) {
+  boolector_solver* s = (boolector_solver*) instance;
+  const char*       assignment;
+  uint64_t          value;
+
+  assignment = boolector_bv_assignment(s->btor, btor_backend_translate(s, t));
+  value      = binary_string_to_uint64(assignment);
+
+  boolector_free_bv_assignment(s->btor, assignment);
+
+  return value;
+}
+
+void btor_backend_print_model(void* instance) {
+  boolector_print_model(((boolector_solver*) instance)->btor, (char*) "smt2", stdout);
+}
+
+void btor_backend_interrupt(void* instance) {
+  ((boolector_solver*) instance)->terminate = 1;
+}
+
+void btor_backend_set_timeout(void* instance, uint64_t milliseconds) {
+  ((boolector_solver*) instance)->timeout = milliseconds;
+}
+
+// narrowed terms only serve the query they were translated for,
+// except for variables which must not be declared twice
+void btor_backend_set_width(void* instance, uint64_t width) {
+  boolector_solver* s = (boolector_solver*) instance;
+  std::unordered_map<uint64_t, BoolectorNode*>::iterator it;
+
+  if (width == 64) {
+    it = s->narrowed.begin();
+
+    while (it != s->narrowed.end()) {
+      if (is_variable(it->first / 64))
+        it++;
+      else {
+        boolector_release(s->btor, it->second);
+
+        s->number_of_released = s->number_of_released + 1;
+
+        it = s->narrowed.erase(it);
+      }
+    }
+  }
+
+  s->width = width;
+}
+
+// terms are created in the order of their operands, so releasing a
+// suffix of the terms never leaves a translated term with released
+// operands. variables are kept for the same reason as above
+void btor_backend_release(void* instance, uint64_t first) {
+  boolector_solver* s = (boolector_solver*) instance;
+  uint64_t          t = first;
+
+  while (t < s->nodes.size()) {
+    if (s->nodes[t] != 0)
+      if (is_variable(t) == 0) {
+        boolector_release(s->btor, s->nodes[t]);
+
+        s->nodes[t] = 0;
+
+        s->number_of_released = s->number_of_released + 1;
+      }
+
+    t = t + 1;
+  }
+}
+
+void btor_backend_print_statistics(void* instance) {
+  boolector_solver* s = (boolector_solver*) instance;
+
+  printf("boolector: %llu node references held, %llu released\n",
+    (unsigned long long) boolector_get_refs(s->btor),
+    (unsigned long long) s->number_of_released);
+}
+
+// boolector only deletes an instance without references left
+void btor_backend_destroy(void* instance) {
+  boolector_solver* s = (boolector_solver*) instance;
+
+  boolector_release_all(s->btor);
+  boolector_delete(s->btor);
+
+  delete s;
+}
+
+solver_backend boolector_backend = {
+  "boolector",
+  btor_backend_create,
+  btor_backend_push,
+  btor_backend_pop,
+  btor_backend_assert_formula,
+  btor_backend_check,
+  btor_backend_assert_guarded,
+  btor_backend_check_assuming,
+  btor_backend_get_core,
+  btor_backend_get_value,
+  btor_backend_print_model,
+  btor_backend_interrupt,
+  btor_backend_set_timeout,
+  btor_backend_set_width,
+  btor_backend_release,
+  btor_backend_print_statistics,
+  btor_backend_destroy
+};
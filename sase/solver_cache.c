@@ -0,0 +1,253 @@
+/*
+  This project contains part of the Selfie Project source code
+  which is governed by a BSD license. For further information
+  and LICENSE conditions see the following website:
+  http://selfie.cs.uni-salzburg.at
+
+  The query cache remembers the outcome of solver checks.
+  A query is the set of asserted constraints. Terms are
+  hash-consed, so recreating the same constraint along another
+  path yields the same term and still hits the cache. Entries
+  are compared by term indices, structural hashes only select
+  the bucket of an entry. Subset and superset hits are found
+  through indices from terms to the entries containing them,
+  so they cover the whole cache.
+*/
+
+#include <stdio.h>
+#include <algorithm>
+#include "solver.h"
+
+struct cache_entry {
+  std::vector<uint64_t> constraints; // sorted term indices
+  uint64_t              result;
+  solver_model          model;
+};
+
+thread_local uint64_t use_query_cache = 1;
+
+uint64_t MAX_CACHE_ENTRIES = 65536;
+
+thread_local std::unordered_map<uint64_t, cache_entry*> cache_entries;
+
+// an unsat subset of a query contains the largest term of the subset,
+// so unsat entries are only indexed by their largest term. a sat
+// superset contains every term of the query, so sat entries are
+// indexed by all their terms and the rarest term of the query is tried
+thread_local std::unordered_map<uint64_t, std::vector<cache_entry*>> unsat_by_last;
+thread_local std::unordered_map<uint64_t, std::vector<cache_entry*>> sat_by_term;
+
+thread_local uint64_t cache_queries        = 0;
+thread_local uint64_t cache_exact_hits     = 0;
+thread_local uint64_t cache_subset_hits    = 0; // an unsat subset implies unsat
+thread_local uint64_t cache_superset_hits  = 0; // a model of a superset satisfies the subset
+
+void canonical_constraints(std::vector<uint64_t>* constraints, std::vector<uint64_t>* terms) {
+  *terms = *constraints;
+
+  std::sort(terms->begin(), terms->end());
+
+  terms->erase(std::unique(terms->begin(), terms->end()), terms->end());
+}
+
+// equal sets of terms have equal keys, unequal sets may collide
+uint64_t cache_key(std::vector<uint64_t>* terms) {
+  uint64_t key = terms->size();
+  uint64_t i   = 0;
+
+  while (i < terms->size()) {
+    key = mix_hash(key, get_term_hash((*terms)[i]));
+
+    i = i + 1;
+  }
+
+  return key;
+}
+
+uint64_t is_subset(std::vector<uint64_t>* sub, std::vector<uint64_t>* super) {
+  if (sub->size() > super->size())
+    return 0;
+
+  return std::includes(super->begin(), super->end(), sub->begin(), sub->end());
+}
+
+uint64_t query_cache_lookup(std::vector<uint64_t>* constraints, solver_model** model) {
+  std::vector<uint64_t> terms;
+  std::unordered_map<uint64_t, cache_entry*>::iterator it;
+  std::unordered_map<uint64_t, std::vector<cache_entry*>>::iterator postings;
+  std::vector<cache_entry*>* candidates;
+  cache_entry* e;
+  uint64_t     i;
+  uint64_t     j;
+
+  cache_queries = cache_queries + 1;
+
+  canonical_constraints(constraints, &terms);
+
+  it = cache_entries.find(cache_key(&terms));
+
+  if (it != cache_entries.end()) {
+    e = it->second;
+
+    if (e->constraints == terms) {
+      cache_exact_hits = cache_exact_hits + 1;
+
+      if (e->result == SOLVER_SAT)
+        *model = &e->model;
+
+      return e->result;
+    }
+  }
+
+  i = 0;
+
+  while (i < terms.size()) {
+    postings = unsat_by_last.find(terms[i]);
+
+    if (postings != unsat_by_last.end()) {
+      j = 0;
+
+      while (j < postings->second.size()) {
+        if (is_subset(&postings->second[j]->constraints, &terms)) {
+          cache_subset_hits = cache_subset_hits + 1;
+
+          return SOLVER_UNSAT;
+        }
+
+        j = j + 1;
+      }
+    }
+
+    i = i + 1;
+  }
+
+  if (terms.size() == 0)
+    return SOLVER_UNKNOWN;
+
+  candidates = 0;
+
+  i = 0;
+
+  while (i < terms.size()) {
+    postings = sat_by_term.find(terms[i]);
+
+    // no sat entry contains this term, so none is a superset
+    if (postings == sat_by_term.end())
+      return SOLVER_UNKNOWN;
+
+    if (candidates == 0)
+      candidates = &postings->second;
+    else if (postings->second.size() < candidates->size())
+      candidates = &postings->second;
+
+    i = i + 1;
+  }
+
+  // the most recent superset first, its model is closest to the path
+  j = candidates->size();
+
+  while (j > 0) {
+    j = j - 1;
+
+    if (is_subset(&terms, &(*candidates)[j]->constraints)) {
+      cache_superset_hits = cache_superset_hits + 1;
+
+      *model = &(*candidates)[j]->model;
+
+      return SOLVER_SAT;
+    }
+  }
+
+  return SOLVER_UNKNOWN;
+}
+
+void query_cache_clear() {
+  std::unordered_map<uint64_t, cache_entry*>::iterator it;
+
+  for (it = cache_entries.begin(); it != cache_entries.end(); it++)
+    delete it->second;
+
+  cache_entries.clear();
+  unsat_by_last.clear();
+  sat_by_term.clear();
+}
+
+void unlist(std::unordered_map<uint64_t, std::vector<cache_entry*>>* index, uint64_t t, cache_entry* e) {
+  std::vector<cache_entry*>* postings = &(*index)[t];
+
+  postings->erase(std::remove(postings->begin(), postings->end(), e), postings->end());
+
+  if (postings->size() == 0)
+    index->erase(t);
+}
+
+// adds e to the index of its result, or removes it from there
+void index_entry(cache_entry* e, uint64_t add) {
+  uint64_t i = 0;
+
+  if (e->result == SOLVER_UNSAT) {
+    if (e->constraints.size() > 0) {
+      if (add)
+        unsat_by_last[e->constraints.back()].push_back(e);
+      else
+        unlist(&unsat_by_last, e->constraints.back(), e);
+    }
+  } else
+    while (i < e->constraints.size()) {
+      if (add)
+        sat_by_term[e->constraints[i]].push_back(e);
+      else
+        unlist(&sat_by_term, e->constraints[i], e);
+
+      i = i + 1;
+    }
+}
+
+void query_cache_insert(std::vector<uint64_t>* constraints, uint64_t result, solver_model* model) {
+  cache_entry* e;
+  uint64_t     key;
+
+  // start over instead of growing without bound along deep paths
+  if (cache_entries.size() >= MAX_CACHE_ENTRIES)
+    query_cache_clear();
+
+  e = new cache_entry();
+
+  canonical_constraints(constraints, &e->constraints);
+
+  e->result = result;
+
+  if (result == SOLVER_SAT)
+    e->model = *model;
+
+  key = cache_key(&e->constraints);
+
+  if (cache_entries.count(key)) {
+    // the same query or a collision of keys replaces the older entry
+    index_entry(cache_entries[key], 0);
+
+    delete cache_entries[key];
+  }
+
+  cache_entries[key] = e;
+
+  index_entry(e, 1);
+}
+
+double hit_ratio(uint64_t hits) {
+  if (cache_queries > 0)
+    return 100.0 * hits / cache_queries;
+  else
+    return 0;
+}
+
+void query_cache_print_statistics() {
+  uint64_t hits = cache_exact_hits + cache_subset_hits + cache_superset_hits;
+
+  printf("query cache: %llu queries, %llu hits (%.2f%%)\n",
+    (unsigned long long) cache_queries, (unsigned long long) hits, hit_ratio(hits));
+  printf("query cache: %llu exact (%.2f%%), %llu unsat subset (%.2f%%), %llu sat superset (%.2f%%)\n",
+    (unsigned long long) cache_exact_hits, hit_ratio(cache_exact_hits),
+    (unsigned long long) cache_subset_hits, hit_ratio(cache_subset_hits),
+    (unsigned long long) cache_superset_hits, hit_ratio(cache_superset_hits));
+}
@@ -0,0 +1,280 @@
+/*
+  This project contains part of the Selfie Project source code
+  which is governed by a BSD license. For further information
+  and LICENSE conditions see the following website:
+  http://selfie.cs.uni-salzburg.at
+
+  Furthermore this project uses the api of cvc4 SMT solver
+  further information: cvc4.cs.stanford.edu/web
+*/
+
+#include <string.h>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include "api/cvc4cpp.h"
+#include "solver.h"
+
+using namespace CVC4::api;
+
+struct cvc4_solver {
+  Solver            slv;
+  Sort              bitvector64;
+  std::vector<Term> terms; // translated terms
+  std::vector<Term> acts;  // activation literals of guarded terms
+  uint32_t          width; // of following translations
+  std::unordered_map<uint64_t, Term> narrowed; // terms translated below 64 bits by t * 64 + width
+};
+
+thread_local uint32_t bv_size = 64;
+
+uint64_t cvc4_is_translated(void* instance, uint64_t t) {
+  cvc4_solver* s = (cvc4_solver*) instance;
+
+  if (s->width < bv_size)
+    return s->narrowed.count(t * 64 + s->width);
+  else if (t < s->terms.size())
+    return s->terms[t].isNull() == 0;
+  else
+    return 0;
+}
+
+Term cvc4_term(cvc4_solver* s, uint64_t t) {
+  if (s->width < bv_size)
+    return s->narrowed[t * 64 + s->width];
+  else
+    return s->terms[t];
+}
+
+void cvc4_translate_node(void* instance, uint64_t t) {
+  cvc4_solver* s  = (cvc4_solver*) instance;
+  uint8_t      op = get_term_op(t);
+  Term         e;
+  Term         l;
+  Term         r;
+
+  if (op == TERM_CONST)
+    e = s->slv.mkBitVector(s->width, value_at(get_term_value(t), s->width));
+  else if (is_variable(t)) {
+    if (s->width < bv_size)
+      e = s->slv.mkVar(variable_name_at(t, s->width), s->slv.mkBitVectorSort(s->width));
+    else
+      e = s->slv.mkVar(variable_name(t), s->bitvector64);
+  } else {
+    l = cvc4_term(s, get_term_left(t));
+    r = cvc4_term(s, get_term_right(t));
+
+    if (op == TERM_ADD)
+      e = s->slv.mkTerm(BITVECTOR_PLUS, l, r);
+    else if (op == TERM_SUB)
+      e = s->slv.mkTerm(BITVECTOR_SUB, l, r);
+    else if (op == TERM_MUL)
+      e = s->slv.mkTerm(BITVECTOR_MULT, l, r);
+    else if (op == TERM_UDIV)
+      e = s->slv.mkTerm(BITVECTOR_UDIV, l, r);
+    else if (op == TERM_UREM)
+      e = s->slv.mkTerm(BITVECTOR_UREM, l, r);
+    else if (op == TERM_ULT)
+      e = s->slv.mkTerm(BITVECTOR_ULT, l, r);
+    else if (op == TERM_UGE)
+      e = s->slv.mkTerm(BITVECTOR_UGE, l, r);
+    else if (op == TERM_ULE)
+      e = s->slv.mkTerm(BITVECTOR_ULE, l, r);
+    else if (op == TERM_ITE)
+      e = s->slv.mkTerm(ITE, cvc4_term(s, get_term_value(t)), l, r);
+    else
+      e = s->slv.mkTerm(EQUAL, l, r);
+  }
+
+  if (s->width < bv_size)
+    s->narrowed[t * 64 + s->width] = e;
+  else {
+    if (t >= s->terms.size())
+      s->terms.resize(number_of_terms);
+
+    s->terms[t] = e;
+  }
+}
+
+Term cvc4_translate(cvc4_solver* s, uint64_t t) {
+  translate_term(s, t, cvc4_is_translated, cvc4_translate_node);
+
+  return cvc4_term(s, t);
+}
+
+void* cvc4_create() {
+  cvc4_solver* s = new cvc4_solver();
+
+  if (strcmp(solver_profile, "default") != 0)
+    s->slv.setLogic("QF_BV");
+
+  if (strcmp(solver_profile, "light") == 0)
+    s->slv.setOption("simplification", "none");
+
+  s->slv.setOption("produce-models", "true");
+  s->slv.setOption("incremental", "true");
+  s->slv.setOption("produce-unsat-assumptions", "true");
+
+  s->bitvector64 = s->slv.mkBitVectorSort(bv_size);
+  s->width       = bv_size;
+
+  return s;
+}
+
+void cvc4_push(void* instance) {
+  ((cvc4_solver*) instance)->slv.push();
+}
+
+void cvc4_pop(void* instance) {
+  ((cvc4_solver*) instance)->slv.pop();
+}
+
+void cvc4_assert_formula(void* instance, uint64_t t) {
+  cvc4_solver* s = (cvc4_solver*) instance;
+
+  s->slv.assertFormula(cvc4_translate(s, t));
+}
+
+uint64_t cvc4_check(void* instance) {
+  Result r = ((cvc4_solver*) instance)->slv.checkSat();
+
+  if (r.isSat())
+    return SOLVER_SAT;
+  else if (r.isUnsat())
+    return SOLVER_UNSAT;
+  else
+    return SOLVER_UNKNOWN;
+}
+
+void cvc4_assert_guarded(void* instance, uint64_t t) {
+  cvc4_solver* s = (cvc4_solver*) instance;
+  std::string  name = "a_" + std::to_string(t);
+  Term         a;
+
+  a = s->slv.mkVar(name, s->slv.getBooleanSort());
+
+  if (t >= s->acts.size())
+    s->acts.resize(number_of_terms);
+
+  s->acts[t] = a;
+
+  s->slv.assertFormula(s->slv.mkTerm(IMPLIES, a, cvc4_translate(s, t)));
+}
+
+uint64_t cvc4_check_assuming(void* instance, std::vector<uint64_t>* ts) {
+  cvc4_solver*      s = (cvc4_solver*) instance;
+  std::vector<Term> assumptions;
+  Result            r;
+  uint64_t          i = 0;
+
+  while (i < ts->size()) {
+    assumptions.push_back(s->acts[(*ts)[i]]);
+
+    i = i + 1;
+  }
+
+  r = s->slv.checkSatAssuming(assumptions);
+
+  if (r.isSat())
+    return SOLVER_SAT;
+  else if (r.isUnsat())
+    return SOLVER_UNSAT;
+  else
+    return SOLVER_UNKNOWN;
+}
+
+void cvc4_get_core(void* instance, std::vector<uint64_t>* ts) {
+  std::vector<Term> core = ((cvc4_solver*) instance)->slv.getUnsatAssumptions();
+  uint64_t          i = 0;
+
+  // activation literals are named a_t
+  while (i < core.size()) {
+    ts->push_back(std::stoull(core[i].toString().substr(2)));
+
+    i = i + 1;
+  }
+}
+
+uint64_t cvc4_get_value(void* instance, uint64_t t) {
+  cvc4_solver* s = (cvc4_solver*) instance;
+  std::string  v = s->slv.getValue(cvc4_translate(s, t)).toString();
+
+  // bit-vector values are printed either as #b... or (_ bvN 64)
+  if (v.compare(0, 2, "#b") == 0)
+    return binary_string_to_uint64(v.c_str() + 2);
+  else if (v.compare(0, 5, "(_ bv") == 0)
+    return std::stoull(v.substr(5));
+  else
+    return 0;
+}
+
+void cvc4_print_model(void* instance) {
+  ((cvc4_solver*) instance)->slv.printModel(std::cout);
+}
+
+void cvc4_set_timeout(void* instance, uint64_t milliseconds) {
+  // a per-check limit of 0 means no limit in cvc4 as well
+  ((cvc4_solver*) instance)->slv.setOption("tlimit-per", std::to_string(milliseconds));
+}
+
+// narrowed terms only serve the query they were translated for,
+// except for variables which must not be declared twice
+void cvc4_set_width(void* instance, uint64_t width) {
+  cvc4_solver* s = (cvc4_solver*) instance;
+  std::unordered_map<uint64_t, Term>::iterator it;
+
+  if (width == bv_size) {
+    it = s->narrowed.begin();
+
+    while (it != s->narrowed.end()) {
+      if (is_variable(it->first / 64))
+        it++;
+      else
+        it = s->narrowed.erase(it);
+    }
+  }
+
+  s->width = width;
+}
+
+// terms are reference counted by the api, so dropping the translations
+// of a suffix of the terms frees them once no assertion holds them.
+// mkVar declares a new variable every time, so variables are kept
+void cvc4_release(void* instance, uint64_t first) {
+  cvc4_solver* s = (cvc4_solver*) instance;
+  uint64_t     t = first;
+
+  while (t < s->terms.size()) {
+    if (s->terms[t].isNull() == 0)
+      if (is_variable(t) == 0)
+        s->terms[t] = Term();
+
+    t = t + 1;
+  }
+}
+
+// the terms are destructed before the solver they belong to
+void cvc4_destroy(void* instance) {
+  delete (cvc4_solver*) instance;
+}
+
+solver_backend cvc4_backend = {
+  "cvc4",
+  cvc4_create,
+  cvc4_push,
+  cvc4_pop,
+  cvc4_assert_formula,
+  cvc4_check,
+  cvc4_assert_guarded,
+  cvc4_check_assuming,
+  cvc4_get_core,
+  cvc4_get_value,
+  cvc4_print_model,
+  0, // the cvc4 api offers no way to interrupt a running check
+  cvc4_set_timeout,
+  cvc4_set_width,
+  cvc4_release,
+  0,
+  cvc4_destroy
+};
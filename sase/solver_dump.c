@@ -0,0 +1,175 @@
+/*
+  This project contains part of the Selfie Project source code
+  which is governed by a BSD license. For further information
+  and LICENSE conditions see the following website:
+  http://selfie.cs.uni-salzburg.at
+
+  Query dumps write the constraints of a check as a self-contained
+  SMT-LIB2 file. Every non-variable term becomes a define-fun of
+  its own, so terms shared within the query are written once.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+#include "solver.h"
+
+thread_local char* dump_directory = 0;
+
+thread_local uint64_t dump_worker = 0;
+
+thread_local uint64_t number_of_dumped_queries = 0;
+
+const char* result_name(uint64_t result) {
+  if (result == SOLVER_SAT)
+    return "sat";
+  else if (result == SOLVER_UNSAT)
+    return "unsat";
+  else
+    return "unknown";
+}
+
+const char* smt_op_name(uint8_t op) {
+  if (op == TERM_ADD)
+    return "bvadd";
+  else if (op == TERM_SUB)
+    return "bvsub";
+  else if (op == TERM_MUL)
+    return "bvmul";
+  else if (op == TERM_UDIV)
+    return "bvudiv";
+  else if (op == TERM_UREM)
+    return "bvurem";
+  else if (op == TERM_ULT)
+    return "bvult";
+  else if (op == TERM_UGE)
+    return "bvuge";
+  else if (op == TERM_ULE)
+    return "bvule";
+  else if (op == TERM_ITE)
+    return "ite";
+  else
+    return "=";
+}
+
+void dump_operand(FILE* file, uint64_t t) {
+  if (get_term_op(t) == TERM_CONST)
+    fprintf(file, "(_ bv%llu 64)", (unsigned long long) get_term_value(t));
+  else if (is_variable(t))
+    fprintf(file, "%s", variable_name(t));
+  else
+    fprintf(file, "t%llu", (unsigned long long) t);
+}
+
+void dump_constraints(FILE* file, std::vector<uint64_t>* constraints) {
+  std::unordered_map<uint64_t, uint64_t> visited;
+  std::vector<uint64_t> stack;
+  std::vector<uint64_t> order; // non-variable terms in post-order
+  uint64_t n;
+  uint64_t i;
+
+  stack = *constraints;
+
+  while (stack.empty() == 0) {
+    n = stack.back();
+
+    if (visited.count(n)) {
+      if (visited[n] == 1) {
+        // both operands are done
+        visited[n] = 2;
+
+        if (get_term_op(n) > TERM_READ)
+          order.push_back(n);
+      }
+
+      stack.pop_back();
+    } else {
+      visited[n] = 1;
+
+      if (get_term_op(n) == TERM_CONST)
+        visited[n] = 2;
+      else if (is_variable(n)) {
+        visited[n] = 2;
+
+        fprintf(file, "(declare-fun %s () (_ BitVec 64))\n", variable_name(n));
+      } else {
+        stack.push_back(get_term_right(n));
+        stack.push_back(get_term_left(n));
+
+        if (get_term_op(n) == TERM_ITE)
+          stack.push_back(get_term_value(n));
+      }
+    }
+  }
+
+  i = 0;
+
+  while (i < order.size()) {
+    n = order[i];
+
+    if (get_term_op(n) == TERM_ITE)
+      fprintf(file, "(define-fun t%llu () (_ BitVec 64) (", (unsigned long long) n);
+    else if (get_term_op(n) >= TERM_ULT)
+      fprintf(file, "(define-fun t%llu () Bool (", (unsigned long long) n);
+    else
+      fprintf(file, "(define-fun t%llu () (_ BitVec 64) (", (unsigned long long) n);
+
+    fprintf(file, "%s ", smt_op_name(get_term_op(n)));
+
+    if (get_term_op(n) == TERM_ITE) {
+      dump_operand(file, get_term_value(n));
+      fprintf(file, " ");
+    }
+
+    dump_operand(file, get_term_left(n));
+    fprintf(file, " ");
+    dump_operand(file, get_term_right(n));
+    fprintf(file, "))\n");
+
+    i = i + 1;
+  }
+
+  i = 0;
+
+  while (i < constraints->size()) {
+    fprintf(file, "(assert t%llu)\n", (unsigned long long) (*constraints)[i]);
+
+    i = i + 1;
+  }
+}
+
+void dump_query(std::vector<uint64_t>* constraints, uint64_t result, uint64_t microseconds, const char* answered_by) {
+  char  name[4096];
+  FILE* file;
+
+  if (number_of_dumped_queries == 0)
+    mkdir(dump_directory, 0755);
+
+  number_of_dumped_queries = number_of_dumped_queries + 1;
+
+  if (dump_worker > 0)
+    snprintf(name, sizeof(name), "%s/query_%03llu_%06llu.smt2", dump_directory, (unsigned long long) dump_worker, (unsigned long long) number_of_dumped_queries);
+  else
+    snprintf(name, sizeof(name), "%s/query_%06llu.smt2", dump_directory, (unsigned long long) number_of_dumped_queries);
+
+  file = fopen(name, "w");
+
+  if (file == 0) {
+    printf("cannot write query dump %s\n", name);
+
+    return;
+  }
+
+  fprintf(file, "; query %llu: %s in %llu us, answered by %s\n",
+    (unsigned long long) number_of_dumped_queries, result_name(result),
+    (unsigned long long) microseconds, answered_by);
+  fprintf(file, "(set-logic QF_BV)\n");
+  fprintf(file, "(set-info :status %s)\n", result_name(result));
+
+  dump_constraints(file, constraints);
+
+  fprintf(file, "(check-sat)\n");
+  fprintf(file, "(exit)\n");
+
+  fclose(file);
+}
@@ -0,0 +1,473 @@
+/*
+  This project contains part of the Selfie Project source code
+  which is governed by a BSD license. For further information
+  and LICENSE conditions see the following website:
+  http://selfie.cs.uni-salzburg.at
+
+  The interval domain keeps an unsigned interval [lo, up] for
+  every variable (in_N, rv_N). Asserted constraints which compare
+  a variable, or a variable plus a constant, with another term
+  narrow the interval of the variable. Intervals of terms are
+  derived bottom-up from the intervals of their variables.
+*/
+
+#include <stdio.h>
+#include "solver.h"
+
+struct interval {
+  uint64_t lo;
+  uint64_t up;
+};
+
+struct interval_undo {
+  uint64_t key;
+  uint64_t existed; // key had an interval before
+  interval old;
+};
+
+thread_local uint64_t use_intervals = 1;
+
+thread_local uint64_t use_width_reduction = 1;
+
+thread_local uint64_t number_of_width_queries  = 0;
+thread_local uint64_t number_of_reduced_queries = 0;
+thread_local uint64_t sum_of_reduced_widths     = 0;
+
+uint64_t MAX_UINT64 = -1;
+
+thread_local std::unordered_map<uint64_t, interval> variable_intervals;
+
+// narrowings are undone when the solver scope they were made in is popped
+thread_local std::vector<interval_undo> interval_log;
+thread_local std::vector<uint64_t>      interval_scopes;
+
+interval full_interval() {
+  interval i;
+
+  i.lo = 0;
+  i.up = MAX_UINT64;
+
+  return i;
+}
+
+interval make_interval(uint64_t lo, uint64_t up) {
+  interval i;
+
+  i.lo = lo;
+  i.up = up;
+
+  return i;
+}
+
+interval variable_interval(uint64_t t) {
+  std::unordered_map<uint64_t, interval>::iterator it;
+
+  it = variable_intervals.find(variable_key(t));
+
+  if (it != variable_intervals.end())
+    return it->second;
+  else
+    return full_interval();
+}
+
+interval apply_interval(uint8_t op, interval l, interval r) {
+  uint64_t lo;
+  uint64_t up;
+
+  if (op == TERM_ADD) {
+    lo = l.lo + r.lo;
+    up = l.up + r.up;
+
+    // either no or both bounds wrap around
+    if (up >= l.up)
+      return make_interval(lo, up);
+    else if (lo < l.lo)
+      return make_interval(lo, up);
+  } else if (op == TERM_SUB) {
+    lo = l.lo - r.up;
+    up = l.up - r.lo;
+
+    if (l.lo >= r.up)
+      return make_interval(lo, up);
+    else if (l.up < r.lo)
+      return make_interval(lo, up);
+  } else if (op == TERM_MUL) {
+    if (l.up == 0)
+      return make_interval(0, 0);
+    else if (r.up <= MAX_UINT64 / l.up)
+      return make_interval(l.lo * r.lo, l.up * r.up);
+  } else if (op == TERM_UDIV) {
+    // division by zero yields all ones
+    if (r.lo > 0)
+      return make_interval(l.lo / r.up, l.up / r.lo);
+  } else if (op == TERM_UREM) {
+    // remainder by zero yields the dividend
+    if (l.up < r.lo)
+      return l;
+    else if (r.lo > 0) {
+      if (l.up < r.up - 1)
+        return make_interval(0, l.up);
+      else
+        return make_interval(0, r.up - 1);
+    } else if (l.up < r.up)
+      return make_interval(0, r.up);
+    else
+      return make_interval(0, l.up);
+  } else if (op == TERM_ULT) {
+    if (l.up < r.lo)
+      return make_interval(1, 1);
+    else if (l.lo >= r.up)
+      return make_interval(0, 0);
+    else
+      return make_interval(0, 1);
+  } else if (op == TERM_UGE) {
+    if (l.lo >= r.up)
+      return make_interval(1, 1);
+    else if (l.up < r.lo)
+      return make_interval(0, 0);
+    else
+      return make_interval(0, 1);
+  } else if (op == TERM_ULE) {
+    if (l.up <= r.lo)
+      return make_interval(1, 1);
+    else if (l.lo > r.up)
+      return make_interval(0, 0);
+    else
+      return make_interval(0, 1);
+  } else if (op == TERM_EQ) {
+    if (l.lo == l.up)
+      if (r.lo == r.up)
+        if (l.lo == r.lo)
+          return make_interval(1, 1);
+
+    if (l.up < r.lo)
+      return make_interval(0, 0);
+    else if (r.up < l.lo)
+      return make_interval(0, 0);
+    else
+      return make_interval(0, 1);
+  } else if (op == TERM_ITE) {
+    // either branch, whatever the condition
+    if (r.lo < l.lo)
+      lo = r.lo;
+    else
+      lo = l.lo;
+
+    if (r.up > l.up)
+      up = r.up;
+    else
+      up = l.up;
+
+    return make_interval(lo, up);
+  }
+
+  return full_interval();
+}
+
+// intervals of terms are memoized in intervals which may be shared
+// among several terms as long as the variable intervals do not change
+interval term_interval_with(uint64_t t, std::unordered_map<uint64_t, interval>& intervals) {
+  std::vector<uint64_t> stack;
+  uint64_t n;
+  uint8_t  op;
+
+  stack.push_back(t);
+
+  while (stack.empty() == 0) {
+    n  = stack.back();
+    op = get_term_op(n);
+
+    if (intervals.count(n))
+      stack.pop_back();
+    else if (op == TERM_CONST) {
+      intervals[n] = make_interval(get_term_value(n), get_term_value(n));
+      stack.pop_back();
+    } else if (op <= TERM_READ) {
+      intervals[n] = variable_interval(n);
+      stack.pop_back();
+    } else if (intervals.count(get_term_left(n)) == 0)
+      stack.push_back(get_term_left(n));
+    else if (intervals.count(get_term_right(n)) == 0)
+      stack.push_back(get_term_right(n));
+    else {
+      intervals[n] = apply_interval(op, intervals[get_term_left(n)], intervals[get_term_right(n)]);
+      stack.pop_back();
+    }
+  }
+
+  return intervals[t];
+}
+
+interval term_interval(uint64_t t) {
+  std::unordered_map<uint64_t, interval> intervals;
+
+  return term_interval_with(t, intervals);
+}
+
+void narrow_variable(uint64_t t, interval i) {
+  interval_undo u;
+  interval      old;
+
+  old = variable_interval(t);
+
+  if (i.lo < old.lo)
+    i.lo = old.lo;
+  if (i.up > old.up)
+    i.up = old.up;
+
+  // an empty interval means the path is infeasible which is left to the solver
+  if (i.lo > i.up)
+    return;
+
+  if (i.lo == old.lo)
+    if (i.up == old.up)
+      return;
+
+  u.key     = variable_key(t);
+  u.existed = variable_intervals.count(u.key);
+  u.old     = old;
+
+  interval_log.push_back(u);
+
+  variable_intervals[u.key] = i;
+}
+
+// narrows the variable in t to the values for which t is in i,
+// looking through additions and subtractions of constants
+void narrow_term(uint64_t t, interval i) {
+  interval l;
+  uint64_t c;
+  uint8_t  op;
+
+  while (1) {
+    op = get_term_op(t);
+
+    if (op == TERM_INPUT || op == TERM_READ) {
+      narrow_variable(t, i);
+
+      return;
+    } else if (op == TERM_ADD) {
+      if (get_term_op(get_term_right(t)) == TERM_CONST) {
+        c = get_term_value(get_term_right(t));
+        t = get_term_left(t);
+      } else if (get_term_op(get_term_left(t)) == TERM_CONST) {
+        c = get_term_value(get_term_left(t));
+        t = get_term_right(t);
+      } else
+        return;
+
+      // t + c must not wrap around
+      l = term_interval(t);
+
+      if (l.up + c < l.up)
+        return;
+      if (i.up < c)
+        return;
+
+      if (i.lo < c)
+        i.lo = 0;
+      else
+        i.lo = i.lo - c;
+
+      i.up = i.up - c;
+    } else if (op == TERM_SUB) {
+      if (get_term_op(get_term_right(t)) != TERM_CONST)
+        return;
+
+      c = get_term_value(get_term_right(t));
+      t = get_term_left(t);
+
+      // t - c must not wrap around
+      l = term_interval(t);
+
+      if (l.lo < c)
+        return;
+
+      if (i.up + c < i.up)
+        i.up = MAX_UINT64;
+      else
+        i.up = i.up + c;
+
+      if (i.lo + c < i.lo)
+        return;
+
+      i.lo = i.lo + c;
+    } else
+      return;
+  }
+}
+
+void interval_assert(uint64_t t) {
+  uint8_t  op = get_term_op(t);
+  uint64_t a;
+  uint64_t b;
+  interval ia;
+  interval ib;
+
+  if (op < TERM_ULT)
+    return;
+  else if (op > TERM_EQ)
+    return;
+
+  a  = get_term_left(t);
+  b  = get_term_right(t);
+  ia = term_interval(a);
+  ib = term_interval(b);
+
+  if (op == TERM_ULT) {
+    // a < b
+    if (ib.up > 0)
+      narrow_term(a, make_interval(0, ib.up - 1));
+    if (ia.lo < MAX_UINT64)
+      narrow_term(b, make_interval(ia.lo + 1, MAX_UINT64));
+  } else if (op == TERM_UGE) {
+    // a >= b
+    narrow_term(a, make_interval(ib.lo, MAX_UINT64));
+    narrow_term(b, make_interval(0, ia.up));
+  } else if (op == TERM_ULE) {
+    // a <= b
+    narrow_term(a, make_interval(0, ib.up));
+    narrow_term(b, make_interval(ia.lo, MAX_UINT64));
+  } else if (op == TERM_EQ) {
+    narrow_term(a, ib);
+    narrow_term(b, ia);
+  }
+}
+
+void interval_push() {
+  interval_scopes.push_back(interval_log.size());
+}
+
+void interval_pop() {
+  interval_undo u;
+
+  while (interval_log.size() > interval_scopes.back()) {
+    u = interval_log.back();
+
+    if (u.existed)
+      variable_intervals[u.key] = u.old;
+    else
+      variable_intervals.erase(u.key);
+
+    interval_log.pop_back();
+  }
+
+  interval_scopes.pop_back();
+}
+
+// undoes every narrowing including those outside of any push
+void interval_reset() {
+  interval_scopes.push_back(0);
+
+  interval_pop();
+}
+
+uint64_t decide_ult(uint64_t a, uint64_t b, uint64_t* result) {
+  interval ia = term_interval(a);
+  interval ib = term_interval(b);
+
+  if (ia.up < ib.lo) {
+    *result = 1;
+
+    return 1;
+  } else if (ia.lo >= ib.up) {
+    *result = 0;
+
+    return 1;
+  }
+
+  return 0;
+}
+
+uint64_t bits_of(uint64_t value) {
+  uint64_t bits = 1;
+
+  while (bits < 64) {
+    if (value < (1ULL << bits))
+      return bits;
+
+    bits = bits + 1;
+  }
+
+  return 64;
+}
+
+uint64_t query_width(std::vector<uint64_t>* query, std::vector<uint64_t>* bounds) {
+  std::unordered_map<uint64_t, interval> intervals;
+  std::unordered_map<uint64_t, uint64_t> visited;
+  std::vector<uint64_t> stack;
+  uint64_t width = 1;
+  uint64_t n;
+  uint8_t  op;
+  interval i;
+
+  number_of_width_queries = number_of_width_queries + 1;
+
+  stack = *query;
+
+  while (stack.empty() == 0) {
+    n = stack.back();
+    stack.pop_back();
+
+    if (visited.count(n) == 0) {
+      visited[n] = 1;
+
+      op = get_term_op(n);
+
+      if (op == TERM_INPUT || op == TERM_READ) {
+        i = variable_interval(n);
+
+        if (bits_of(i.up) > width)
+          width = bits_of(i.up);
+
+        // the solver has to respect the interval at the reduced width
+        if (i.up < MAX_UINT64)
+          bounds->push_back(bv_ule(n, bv_const(i.up)));
+        if (i.lo > 0)
+          bounds->push_back(bv_uge(n, bv_const(i.lo)));
+      } else if (op != TERM_CONST) {
+        // operands of divisions and comparisons have to fit into the width
+        if (op >= TERM_UDIV)
+          if (op <= TERM_EQ) {
+            i = term_interval_with(get_term_left(n), intervals);
+
+            if (bits_of(i.up) > width)
+              width = bits_of(i.up);
+
+            i = term_interval_with(get_term_right(n), intervals);
+
+            if (bits_of(i.up) > width)
+              width = bits_of(i.up);
+          }
+
+        stack.push_back(get_term_left(n));
+        stack.push_back(get_term_right(n));
+
+        if (op == TERM_ITE)
+          stack.push_back(get_term_value(n));
+      }
+
+      if (width == 64)
+        return 64;
+    }
+  }
+
+  number_of_reduced_queries = number_of_reduced_queries + 1;
+  sum_of_reduced_widths     = sum_of_reduced_widths + width;
+
+  return width;
+}
+
+void print_width_statistics() {
+  if (number_of_width_queries == 0)
+    return;
+
+  if (number_of_reduced_queries > 0)
+    printf("width reduction: %llu of %llu queries reduced to %.2f bits on average\n",
+      (unsigned long long) number_of_reduced_queries,
+      (unsigned long long) number_of_width_queries,
+      (double) sum_of_reduced_widths / number_of_reduced_queries);
+  else
+    printf("width reduction: 0 of %llu queries reduced\n",
+      (unsigned long long) number_of_width_queries);
+}
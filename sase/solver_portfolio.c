@@ -0,0 +1,409 @@
+/*
+  This project contains part of the Selfie Project source code
+  which is governed by a BSD license. For further information
+  and LICENSE conditions see the following website:
+  http://selfie.cs.uni-salzburg.at
+
+  The portfolio backend races several solver backends on every
+  check. Each member owns a worker thread and its own native
+  solver instance. The first member which decides a query wins,
+  the others are interrupted.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
+#include <vector>
+#include "solver.h"
+
+extern uint64_t EXITCODE_BADARGUMENTS;
+
+struct portfolio_solver;
+
+struct portfolio_member {
+  solver_backend*   backend;
+  void*             instance;
+  portfolio_solver* owner;
+  pthread_t         thread;
+  uint64_t          round;  // last check round seen by the worker
+  uint64_t          busy;   // worker is running a check
+  uint64_t          result;
+  uint64_t          wins;
+};
+
+struct portfolio_solver {
+  std::vector<portfolio_member*> members;
+  pthread_mutex_t                lock;
+  pthread_cond_t                 start; // a new check round has begun
+  pthread_cond_t                 done;  // a worker has finished its check
+  uint64_t                       round;
+  portfolio_member*              winner;
+  std::vector<uint64_t>*         assumptions; // of the current check, 0 if none
+  portfolio_member*              last;  // member holding the most recent model
+  uint64_t                       number_of_checks;
+  uint64_t                       number_of_undecided;
+};
+
+// backends raced by the portfolio, set by select_portfolio
+thread_local std::vector<solver_backend*> portfolio_backends;
+
+void* portfolio_worker(void* arg) {
+  portfolio_member* m = (portfolio_member*) arg;
+  portfolio_solver* s = m->owner;
+  uint64_t          r;
+
+  while (1) {
+    pthread_mutex_lock(&s->lock);
+
+    while (m->round == s->round)
+      pthread_cond_wait(&s->start, &s->lock);
+
+    m->round = s->round;
+
+    pthread_mutex_unlock(&s->lock);
+
+    if (s->assumptions != 0)
+      r = m->backend->check_assuming(m->instance, s->assumptions);
+    else
+      r = m->backend->check(m->instance);
+
+    pthread_mutex_lock(&s->lock);
+
+    m->result = r;
+    m->busy   = 0;
+
+    if (s->winner == 0)
+      if (r != SOLVER_UNKNOWN)
+        s->winner = m;
+
+    pthread_cond_signal(&s->done);
+    pthread_mutex_unlock(&s->lock);
+  }
+
+  return 0;
+}
+
+uint64_t portfolio_is_busy(portfolio_solver* s) {
+  uint64_t i = 0;
+
+  while (i < s->members.size()) {
+    if (s->members[i]->busy)
+      return 1;
+
+    i = i + 1;
+  }
+
+  return 0;
+}
+
+void portfolio_wait(portfolio_solver* s, uint64_t nanoseconds) {
+  struct timespec deadline;
+
+  clock_gettime(CLOCK_REALTIME, &deadline);
+
+  deadline.tv_nsec = deadline.tv_nsec + nanoseconds;
+
+  if (deadline.tv_nsec >= 1000000000) {
+    deadline.tv_sec  = deadline.tv_sec + 1;
+    deadline.tv_nsec = deadline.tv_nsec - 1000000000;
+  }
+
+  pthread_cond_timedwait(&s->done, &s->lock, &deadline);
+}
+
+void select_portfolio(char* names) {
+  char* name;
+  char* rest; // strtok would share its position with other explorers
+
+  name = strtok_r(names, ",", &rest);
+
+  while (name != 0) {
+    if (find_solver(name)->assert_guarded == 0)
+      portfolio_backend.assert_guarded = 0;
+    if (find_solver(name)->set_width == 0)
+      portfolio_backend.set_width = 0;
+    if (find_solver(name)->get_core == 0)
+      portfolio_backend.get_core = 0;
+
+    portfolio_backends.push_back(find_solver(name));
+
+    name = strtok_r(0, ",", &rest);
+  }
+
+  if (portfolio_backends.size() == 0) {
+    printf("%s\n", "portfolio needs at least one solver");
+
+    exit_explorer(EXITCODE_BADARGUMENTS);
+  }
+
+  backend = &portfolio_backend;
+}
+
+void* portfolio_create() {
+  portfolio_solver* s = new portfolio_solver();
+  portfolio_member* m;
+  uint64_t          i = 0;
+
+  pthread_mutex_init(&s->lock, 0);
+  pthread_cond_init(&s->start, 0);
+  pthread_cond_init(&s->done, 0);
+
+  while (i < portfolio_backends.size()) {
+    m = new portfolio_member();
+
+    m->backend  = portfolio_backends[i];
+    m->instance = m->backend->create();
+    m->owner    = s;
+
+    s->members.push_back(m);
+
+    pthread_create(&m->thread, 0, portfolio_worker, m);
+
+    i = i + 1;
+  }
+
+  s->last = s->members[0];
+
+  return s;
+}
+
+// push, pop and assert are forwarded to all members on the calling
+// thread since translation reads the term table which may grow
+
+void portfolio_push(void* instance) {
+  portfolio_solver* s = (portfolio_solver*) instance;
+  uint64_t          i = 0;
+
+  while (i < s->members.size()) {
+    s->members[i]->backend->push(s->members[i]->instance);
+
+    i = i + 1;
+  }
+}
+
+void portfolio_pop(void* instance) {
+  portfolio_solver* s = (portfolio_solver*) instance;
+  uint64_t          i = 0;
+
+  while (i < s->members.size()) {
+    s->members[i]->backend->pop(s->members[i]->instance);
+
+    i = i + 1;
+  }
+}
+
+void portfolio_assert_formula(void* instance, uint64_t t) {
+  portfolio_solver* s = (portfolio_solver*) instance;
+  uint64_t          i = 0;
+
+  while (i < s->members.size()) {
+    s->members[i]->backend->assert_formula(s->members[i]->instance, t);
+
+    i = i + 1;
+  }
+}
+
+void portfolio_assert_guarded(void* instance, uint64_t t) {
+  portfolio_solver* s = (portfolio_solver*) instance;
+  uint64_t          i = 0;
+
+  while (i < s->members.size()) {
+    s->members[i]->backend->assert_guarded(s->members[i]->instance, t);
+
+    i = i + 1;
+  }
+}
+
+uint64_t portfolio_race(portfolio_solver* s, std::vector<uint64_t>* assumptions) {
+  portfolio_member* m;
+  uint64_t          i;
+
+  pthread_mutex_lock(&s->lock);
+
+  s->winner      = 0;
+  s->assumptions = assumptions;
+
+  i = 0;
+
+  while (i < s->members.size()) {
+    s->members[i]->busy = 1;
+
+    i = i + 1;
+  }
+
+  s->round = s->round + 1;
+
+  pthread_cond_broadcast(&s->start);
+
+  while (s->winner == 0)
+    if (portfolio_is_busy(s))
+      pthread_cond_wait(&s->done, &s->lock);
+    else
+      break;
+
+  // an interrupt may arrive before a worker has actually entered its
+  // check, so keep interrupting until every worker is idle again.
+  // members without interrupt support are waited for.
+  while (portfolio_is_busy(s)) {
+    i = 0;
+
+    while (i < s->members.size()) {
+      m = s->members[i];
+
+      if (m->busy)
+        if (m->backend->interrupt != 0)
+          m->backend->interrupt(m->instance);
+
+      i = i + 1;
+    }
+
+    portfolio_wait(s, 1000000);
+  }
+
+  s->number_of_checks = s->number_of_checks + 1;
+
+  m = s->winner;
+
+  pthread_mutex_unlock(&s->lock);
+
+  if (m == 0) {
+    s->number_of_undecided = s->number_of_undecided + 1;
+
+    s->last = s->members[0];
+
+    return SOLVER_UNKNOWN;
+  }
+
+  m->wins = m->wins + 1;
+
+  s->last = m;
+
+  return m->result;
+}
+
+uint64_t portfolio_check(void* instance) {
+  return portfolio_race((portfolio_solver*) instance, 0);
+}
+
+uint64_t portfolio_check_assuming(void* instance, std::vector<uint64_t>* ts) {
+  return portfolio_race((portfolio_solver*) instance, ts);
+}
+
+void portfolio_get_core(void* instance, std::vector<uint64_t>* ts) {
+  portfolio_solver* s = (portfolio_solver*) instance;
+
+  // the winner of the most recent check answered unsat
+  s->last->backend->get_core(s->last->instance, ts);
+}
+
+uint64_t portfolio_get_value(void* instance, uint64_t t) {
+  portfolio_solver* s = (portfolio_solver*) instance;
+
+  return s->last->backend->get_value(s->last->instance, t);
+}
+
+void portfolio_print_model(void* instance) {
+  portfolio_solver* s = (portfolio_solver*) instance;
+
+  s->last->backend->print_model(s->last->instance);
+}
+
+void portfolio_interrupt(void* instance) {
+  portfolio_solver* s = (portfolio_solver*) instance;
+  portfolio_member* m;
+  uint64_t          i = 0;
+
+  while (i < s->members.size()) {
+    m = s->members[i];
+
+    if (m->backend->interrupt != 0)
+      m->backend->interrupt(m->instance);
+
+    i = i + 1;
+  }
+}
+
+void portfolio_set_timeout(void* instance, uint64_t milliseconds) {
+  portfolio_solver* s = (portfolio_solver*) instance;
+  portfolio_member* m;
+  uint64_t          i = 0;
+
+  while (i < s->members.size()) {
+    m = s->members[i];
+
+    if (m->backend->set_timeout != 0)
+      m->backend->set_timeout(m->instance, milliseconds);
+
+    i = i + 1;
+  }
+}
+
+void portfolio_set_width(void* instance, uint64_t width) {
+  portfolio_solver* s = (portfolio_solver*) instance;
+  uint64_t          i = 0;
+
+  while (i < s->members.size()) {
+    s->members[i]->backend->set_width(s->members[i]->instance, width);
+
+    i = i + 1;
+  }
+}
+
+void portfolio_release(void* instance, uint64_t first) {
+  portfolio_solver* s = (portfolio_solver*) instance;
+  portfolio_member* m;
+  uint64_t          i = 0;
+
+  while (i < s->members.size()) {
+    m = s->members[i];
+
+    if (m->backend->release != 0)
+      m->backend->release(m->instance, first);
+
+    i = i + 1;
+  }
+}
+
+void portfolio_print_statistics(void* instance) {
+  portfolio_solver* s = (portfolio_solver*) instance;
+  portfolio_member* m;
+  uint64_t          i = 0;
+
+  printf("portfolio: %llu checks, %llu undecided\n",
+    (unsigned long long) s->number_of_checks,
+    (unsigned long long) s->number_of_undecided);
+
+  while (i < s->members.size()) {
+    m = s->members[i];
+
+    if (s->number_of_checks > 0)
+      printf("portfolio: %s won %llu (%.2f%%)\n", m->backend->name,
+        (unsigned long long) m->wins, 100.0 * m->wins / s->number_of_checks);
+    else
+      printf("portfolio: %s won 0\n", m->backend->name);
+
+    i = i + 1;
+  }
+}
+
+thread_local solver_backend portfolio_backend = {
+  "portfolio",
+  portfolio_create,
+  portfolio_push,
+  portfolio_pop,
+  portfolio_assert_formula,
+  portfolio_check,
+  portfolio_assert_guarded,
+  portfolio_check_assuming,
+  portfolio_get_core,
+  portfolio_get_value,
+  portfolio_print_model,
+  portfolio_interrupt,
+  portfolio_set_timeout,
+  portfolio_set_width,
+  portfolio_release,
+  portfolio_print_statistics,
+  0 // the worker threads of the members live as long as the process
+};
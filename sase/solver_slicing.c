@@ -0,0 +1,285 @@
+/*
+  This project contains part of the Selfie Project source code
+  which is governed by a BSD license. For further information
+  and LICENSE conditions see the following website:
+  http://selfie.cs.uni-salzburg.at
+
+  Constraint slicing partitions the asserted constraints into
+  independent sets which share no variables (in_N, rv_N). A
+  query only needs the sets touched by the constraints asserted
+  since the last sat check, all other sets are satisfied by its
+  model already.
+*/
+
+#include <stdio.h>
+#include <algorithm>
+#include "solver.h"
+
+struct slicing_undo {
+  uint64_t kind;
+  uint64_t a;
+  uint64_t b;
+};
+
+thread_local uint64_t use_slicing = 1;
+
+thread_local uint64_t number_of_sliced_queries = 0;
+thread_local uint64_t number_of_sliced_constraints = 0; // constraints sent to the solver
+thread_local uint64_t number_of_slicable_constraints = 0; // constraints asserted at the time
+
+// variable keys of every constraint ever seen
+thread_local std::unordered_map<uint64_t, std::vector<uint64_t>> constraint_variables;
+
+// union-find over the variable keys of the asserted constraints. it is
+// maintained as constraints are asserted and undone when the solver
+// scope they were asserted in is popped, so there is no path
+// compression and smaller classes are joined into larger ones
+thread_local std::unordered_map<uint64_t, uint64_t> representatives; // roots are their own
+thread_local std::unordered_map<uint64_t, uint64_t> class_sizes;     // of roots
+thread_local std::unordered_map<uint64_t, uint64_t> class_nexts;     // circular list of the variables of a class
+
+// positions of asserted constraints by the first of their variable keys
+thread_local std::unordered_map<uint64_t, std::vector<uint64_t>> constraints_at;
+
+uint64_t UNDO_VARIABLE   = 0; // a was seen for the first time
+uint64_t UNDO_JOIN       = 1; // root a was joined into root b
+uint64_t UNDO_CONSTRAINT = 2; // a constraint was asserted on variable a
+
+thread_local std::vector<slicing_undo> slicing_log;
+thread_local std::vector<uint64_t>     slicing_scopes;
+
+std::vector<uint64_t>* variables_of(uint64_t c) {
+  std::unordered_map<uint64_t, std::vector<uint64_t>>::iterator it;
+  std::vector<uint64_t>  terms;
+  std::vector<uint64_t>  variables;
+  std::vector<uint64_t>* keys;
+  uint64_t               i = 0;
+
+  it = constraint_variables.find(c);
+
+  if (it != constraint_variables.end())
+    return &it->second;
+
+  terms.push_back(c);
+
+  collect_variables(&terms, &variables);
+
+  // elements of an unordered map stay where they are when it grows
+  keys = &constraint_variables[c];
+
+  while (i < variables.size()) {
+    keys->push_back(variable_key(variables[i]));
+
+    i = i + 1;
+  }
+
+  return keys;
+}
+
+void log_slicing(uint64_t kind, uint64_t a, uint64_t b) {
+  slicing_undo u;
+
+  u.kind = kind;
+  u.a    = a;
+  u.b    = b;
+
+  slicing_log.push_back(u);
+}
+
+uint64_t find_representative(uint64_t v) {
+  uint64_t r;
+
+  r = representatives[v];
+
+  while (r != v) {
+    v = r;
+    r = representatives[v];
+  }
+
+  return r;
+}
+
+void add_variable(uint64_t v) {
+  if (representatives.count(v))
+    return;
+
+  representatives[v] = v;
+  class_sizes[v]     = 1;
+  class_nexts[v]     = v;
+
+  log_slicing(UNDO_VARIABLE, v, 0);
+}
+
+void join(uint64_t a, uint64_t b) {
+  uint64_t next;
+
+  a = find_representative(a);
+  b = find_representative(b);
+
+  if (a == b)
+    return;
+
+  if (class_sizes[a] > class_sizes[b])
+    std::swap(a, b);
+
+  representatives[a] = b;
+  class_sizes[b]     = class_sizes[b] + class_sizes[a];
+
+  // swapping the successors of a and b splices both circular lists
+  // into one, swapping them again splits it
+  next           = class_nexts[a];
+  class_nexts[a] = class_nexts[b];
+  class_nexts[b] = next;
+
+  log_slicing(UNDO_JOIN, a, b);
+}
+
+// called with the position of the constraint c just asserted
+void slicing_assert(uint64_t c, uint64_t position) {
+  std::vector<uint64_t>* keys;
+  uint64_t i;
+
+  keys = variables_of(c);
+
+  if (keys->size() == 0)
+    return;
+
+  i = 0;
+
+  while (i < keys->size()) {
+    add_variable((*keys)[i]);
+
+    if (i > 0)
+      join((*keys)[0], (*keys)[i]);
+
+    i = i + 1;
+  }
+
+  constraints_at[(*keys)[0]].push_back(position);
+
+  log_slicing(UNDO_CONSTRAINT, (*keys)[0], 0);
+}
+
+void slicing_push() {
+  slicing_scopes.push_back(slicing_log.size());
+}
+
+void slicing_pop() {
+  slicing_undo u;
+  uint64_t     next;
+
+  while (slicing_log.size() > slicing_scopes.back()) {
+    u = slicing_log.back();
+
+    if (u.kind == UNDO_VARIABLE) {
+      representatives.erase(u.a);
+      class_sizes.erase(u.a);
+      class_nexts.erase(u.a);
+    } else if (u.kind == UNDO_JOIN) {
+      representatives[u.a] = u.a;
+      class_sizes[u.b]     = class_sizes[u.b] - class_sizes[u.a];
+
+      next             = class_nexts[u.a];
+      class_nexts[u.a] = class_nexts[u.b];
+      class_nexts[u.b] = next;
+    } else {
+      constraints_at[u.a].pop_back();
+
+      if (constraints_at[u.a].empty())
+        constraints_at.erase(u.a);
+    }
+
+    slicing_log.pop_back();
+  }
+
+  slicing_scopes.pop_back();
+}
+
+// undoes every constraint including those outside of any push
+void slicing_reset() {
+  slicing_scopes.push_back(0);
+
+  slicing_pop();
+}
+
+// the slice is collected from the classes of the constraints from
+// position from on, so a query costs time in the size of its slice
+// rather than in the number of asserted constraints
+void slice_constraints(std::vector<uint64_t>* constraints, uint64_t from, std::vector<uint64_t>* slice) {
+  std::unordered_map<uint64_t, uint64_t> relevant; // representatives of the slice
+  std::unordered_map<uint64_t, std::vector<uint64_t>>::iterator it;
+  std::vector<uint64_t>  positions;
+  std::vector<uint64_t>* keys;
+  uint64_t i;
+  uint64_t j;
+  uint64_t r;
+  uint64_t v;
+
+  i = from;
+
+  while (i < constraints->size()) {
+    keys = variables_of((*constraints)[i]);
+
+    // constraints from on are always in the slice, even without variables
+    if (keys->size() == 0)
+      positions.push_back(i);
+    else {
+      r = find_representative((*keys)[0]);
+
+      if (relevant.count(r) == 0) {
+        relevant[r] = 1;
+
+        v = r;
+
+        while (1) {
+          it = constraints_at.find(v);
+
+          // constraints beyond the end are asserted but left out
+          // of a check of a prefix
+          if (it != constraints_at.end()) {
+            j = 0;
+
+            while (j < it->second.size()) {
+              if (it->second[j] < constraints->size())
+                positions.push_back(it->second[j]);
+
+              j = j + 1;
+            }
+          }
+
+          v = class_nexts[v];
+
+          if (v == r)
+            break;
+        }
+      }
+    }
+
+    i = i + 1;
+  }
+
+  // in the order of assertion
+  std::sort(positions.begin(), positions.end());
+
+  i = 0;
+
+  while (i < positions.size()) {
+    slice->push_back((*constraints)[positions[i]]);
+
+    i = i + 1;
+  }
+
+  number_of_sliced_queries       = number_of_sliced_queries + 1;
+  number_of_sliced_constraints   = number_of_sliced_constraints + slice->size();
+  number_of_slicable_constraints = number_of_slicable_constraints + constraints->size();
+}
+
+void print_slicing_statistics() {
+  if (number_of_sliced_queries == 0)
+    return;
+
+  printf("slicing: %llu queries, %.2f of %.2f constraints per query on average\n",
+    (unsigned long long) number_of_sliced_queries,
+    (double) number_of_sliced_constraints / number_of_sliced_queries,
+    (double) number_of_slicable_constraints / number_of_sliced_queries);
+}
@@ -0,0 +1,311 @@
+/*
+  This project contains part of the Selfie Project source code
+  which is governed by a BSD license. For further information
+  and LICENSE conditions see the following website:
+  http://selfie.cs.uni-salzburg.at
+
+  Furthermore this project uses the api of z3 SMT solver
+  further information: github.com/Z3Prover/z3
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <iostream>
+#include <vector>
+#include <unordered_map>
+#include "z3++.h"
+#include "solver.h"
+
+using namespace z3;
+
+extern uint64_t EXITCODE_BADARGUMENTS;
+
+struct z3_solver {
+  context             ctx;
+  solver              slv;
+  std::vector<Z3_ast> exprs; // translated terms
+  std::vector<Z3_ast> acts;  // activation literals of guarded terms
+  uint64_t            width; // of following translations
+  std::unordered_map<uint64_t, Z3_ast> narrowed; // terms translated below 64 bits by t * 64 + width
+  uint64_t            number_of_released;
+
+  z3_solver() : slv(ctx), width(64), number_of_released(0) {}
+};
+
+uint64_t z3_is_translated(void* instance, uint64_t t) {
+  z3_solver* s = (z3_solver*) instance;
+
+  if (s->width < 64)
+    return s->narrowed.count(t * 64 + s->width);
+  else if (t < s->exprs.size())
+    return s->exprs[t] != 0;
+  else
+    return 0;
+}
+
+Z3_ast z3_expr(z3_solver* s, uint64_t t) {
+  if (s->width < 64)
+    return s->narrowed[t * 64 + s->width];
+  else
+    return s->exprs[t];
+}
+
+void z3_translate_node(void* instance, uint64_t t) {
+  z3_solver* s = (z3_solver*) instance;
+  uint8_t    op = get_term_op(t);
+  expr       e(s->ctx);
+
+  if (op == TERM_CONST)
+    e = s->ctx.bv_val(value_at(get_term_value(t), s->width), s->width);
+  else if (is_variable(t))
+    e = s->ctx.bv_const(variable_name_at(t, s->width), s->width);
+  else {
+    expr l(s->ctx, z3_expr(s, get_term_left(t)));
+    expr r(s->ctx, z3_expr(s, get_term_right(t)));
+
+    if (op == TERM_ADD)
+      e = l + r;
+    else if (op == TERM_SUB)
+      e = l - r;
+    else if (op == TERM_MUL)
+      e = l * r;
+    else if (op == TERM_UDIV)
+      e = udiv(l, r);
+    else if (op == TERM_UREM)
+      e = urem(l, r);
+    else if (op == TERM_ULT)
+      e = ult(l, r);
+    else if (op == TERM_UGE)
+      e = uge(l, r);
+    else if (op == TERM_ULE)
+      e = ule(l, r);
+    else if (op == TERM_ITE)
+      e = ite(expr(s->ctx, z3_expr(s, get_term_value(t))), l, r);
+    else
+      e = l == r;
+  }
+
+  // keep the native expression alive as long as the solver
+  Z3_inc_ref(s->ctx, e);
+
+  if (s->width < 64)
+    s->narrowed[t * 64 + s->width] = e;
+  else {
+    if (t >= s->exprs.size())
+      s->exprs.resize(number_of_terms, 0);
+
+    s->exprs[t] = e;
+  }
+}
+
+expr z3_translate(z3_solver* s, uint64_t t) {
+  translate_term(s, t, z3_is_translated, z3_translate_node);
+
+  return expr(s->ctx, z3_expr(s, t));
+}
+
+void* z3_create() {
+  z3_solver* s = new z3_solver();
+
+  if (strcmp(solver_profile, "qfbv") == 0)
+    s->slv = solver(s->ctx, "QF_BV");
+  else if (strcmp(solver_profile, "light") == 0) {
+    // the solver of a tactic starts over on every check and has no cores
+    if (use_assumptions) {
+      printf("%s\n", "z3 profile light does not support assumptions");
+
+      exit_explorer(EXITCODE_BADARGUMENTS);
+    }
+
+    s->slv = (tactic(s->ctx, "simplify") & tactic(s->ctx, "bit-blast") & tactic(s->ctx, "sat")).mk_solver();
+  }
+
+  return s;
+}
+
+void z3_push(void* instance) {
+  ((z3_solver*) instance)->slv.push();
+}
+
+void z3_pop(void* instance) {
+  ((z3_solver*) instance)->slv.pop();
+}
+
+void z3_assert_formula(void* instance, uint64_t t) {
+  z3_solver* s = (z3_solver*) instance;
+
+  s->slv.add(z3_translate(s, t));
+}
+
+uint64_t z3_check(void* instance) {
+  check_result r = ((z3_solver*) instance)->slv.check();
+
+  if (r == sat)
+    return SOLVER_SAT;
+  else if (r == unsat)
+    return SOLVER_UNSAT;
+  else
+    return SOLVER_UNKNOWN;
+}
+
+void z3_assert_guarded(void* instance, uint64_t t) {
+  z3_solver* s = (z3_solver*) instance;
+  char       name[32];
+
+  sprintf(name, "a_%llu", (unsigned long long) t);
+
+  expr a = s->ctx.bool_const(name);
+
+  if (t >= s->acts.size())
+    s->acts.resize(number_of_terms, 0);
+
+  Z3_inc_ref(s->ctx, a);
+  s->acts[t] = a;
+
+  s->slv.add(implies(a, z3_translate(s, t)));
+}
+
+uint64_t z3_check_assuming(void* instance, std::vector<uint64_t>* ts) {
+  z3_solver*   s = (z3_solver*) instance;
+  expr_vector  assumptions(s->ctx);
+  check_result r;
+  uint64_t     i = 0;
+
+  while (i < ts->size()) {
+    assumptions.push_back(expr(s->ctx, s->acts[(*ts)[i]]));
+
+    i = i + 1;
+  }
+
+  r = s->slv.check(assumptions);
+
+  if (r == sat)
+    return SOLVER_SAT;
+  else if (r == unsat)
+    return SOLVER_UNSAT;
+  else
+    return SOLVER_UNKNOWN;
+}
+
+void z3_get_core(void* instance, std::vector<uint64_t>* ts) {
+  z3_solver*  s = (z3_solver*) instance;
+  expr_vector core = s->slv.unsat_core();
+  uint64_t    i = 0;
+
+  // activation literals are named a_t
+  while (i < core.size()) {
+    ts->push_back(strtoull(core[i].decl().name().str().c_str() + 2, 0, 10));
+
+    i = i + 1;
+  }
+}
+
+uint64_t z3_get_value(void* instance, uint64_t t) {
+  z3_solver* s = (z3_solver*) instance;
+
+  return s->slv.get_model().eval(z3_translate(s, t), true).get_numeral_uint64();
+}
+
+void z3_print_model(void* instance) {
+  std::cout << ((z3_solver*) instance)->slv.get_model() << "\n";
+}
+
+void z3_interrupt(void* instance) {
+  ((z3_solver*) instance)->ctx.interrupt();
+}
+
+void z3_set_timeout(void* instance, uint64_t milliseconds) {
+  z3_solver* s = (z3_solver*) instance;
+  params     p(s->ctx);
+
+  // z3 has no limit if the timeout is the largest unsigned int
+  if (milliseconds == 0)
+    p.set("timeout", 4294967295U);
+  else
+    p.set("timeout", (unsigned) milliseconds);
+
+  s->slv.set(p);
+}
+
+// narrowed terms only serve the query they were translated for
+void z3_set_width(void* instance, uint64_t width) {
+  z3_solver* s = (z3_solver*) instance;
+  std::unordered_map<uint64_t, Z3_ast>::iterator it;
+
+  if (width == 64) {
+    it = s->narrowed.begin();
+
+    while (it != s->narrowed.end()) {
+      Z3_dec_ref(s->ctx, it->second);
+
+      s->number_of_released = s->number_of_released + 1;
+
+      it = s->narrowed.erase(it);
+    }
+  }
+
+  s->width = width;
+}
+
+// terms are created in the order of their operands, so releasing a
+// suffix of the terms never leaves a translated term with released
+// operands. z3 declares variables again under their name, so unlike
+// in boolector they are released as well
+void z3_release(void* instance, uint64_t first) {
+  z3_solver* s = (z3_solver*) instance;
+  uint64_t   t = first;
+
+  while (t < s->exprs.size()) {
+    if (s->exprs[t] != 0) {
+      Z3_dec_ref(s->ctx, s->exprs[t]);
+
+      s->exprs[t] = 0;
+
+      s->number_of_released = s->number_of_released + 1;
+    }
+
+    t = t + 1;
+  }
+}
+
+void z3_print_statistics(void* instance) {
+  z3_solver* s    = (z3_solver*) instance;
+  uint64_t   held = s->narrowed.size();
+  uint64_t   t    = 0;
+
+  while (t < s->exprs.size()) {
+    if (s->exprs[t] != 0)
+      held = held + 1;
+
+    t = t + 1;
+  }
+
+  printf("z3: %llu expression references held, %llu released\n",
+    (unsigned long long) held, (unsigned long long) s->number_of_released);
+}
+
+// the context frees every expression, referenced or not
+void z3_destroy(void* instance) {
+  delete (z3_solver*) instance;
+}
+
+solver_backend z3_backend = {
+  "z3",
+  z3_create,
+  z3_push,
+  z3_pop,
+  z3_assert_formula,
+  z3_check,
+  z3_assert_guarded,
+  z3_check_assuming,
+  z3_get_core,
+  z3_get_value,
+  z3_print_model,
+  z3_interrupt,
+  z3_set_timeout,
+  z3_set_width,
+  z3_release,
+  z3_print_statistics,
+  z3_destroy
+};